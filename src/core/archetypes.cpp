@@ -0,0 +1,165 @@
+#include "src/core/include/archetypes.hpp"
+
+#include <algorithm>
+
+namespace vecs
+{
+
+Archetype::Archetype(const Signature& signature)
+: a_signature(signature)
+{}
+
+const Signature& Archetype::signature() const
+{
+  return a_signature;
+}
+
+unsigned long Archetype::size() const
+{
+  return a_entities.size();
+}
+
+std::span<const Entity> Archetype::entities() const
+{
+  return a_entities;
+}
+
+ArchetypeManager::ArchetypeManager(EntityManager& e_manager)
+: e_manager(&e_manager)
+{
+  archetypes.emplace_back(std::make_shared<Archetype>(Signature{}));
+  lookup.emplace(Signature{}, 0);
+}
+
+unsigned long ArchetypeManager::count() const
+{
+  return e_manager->count();
+}
+
+bool ArchetypeManager::valid(Entity e_id) const
+{
+  return e_manager->valid(e_id);
+}
+
+Entity ArchetypeManager::new_entity()
+{
+  Entity e_id = e_manager->new_entity();
+  if (!e_id.null())
+    locate(e_id);
+
+  return e_id;
+}
+
+void ArchetypeManager::remove_entity(Entity e_id)
+{
+  if (!valid(e_id)) return;
+
+  if (stored(e_id))
+    erase(locations[e_id.index()].archetype, locations[e_id.index()].row);
+
+  e_manager->remove_entity(e_id);
+}
+
+std::vector<std::shared_ptr<Archetype>> ArchetypeManager::query(const Signature& signature, bool exactMatch) const
+{
+  std::vector<std::shared_ptr<Archetype>> matches;
+  for (const auto& archetype : archetypes)
+  {
+    if (archetype->size() == 0) continue;
+
+    const auto& s = archetype->signature();
+    if (exactMatch ? s == signature : s.contains(signature))
+      matches.emplace_back(archetype);
+  }
+
+  return matches;
+}
+
+bool ArchetypeManager::stored(Entity e_id) const
+{
+  if (e_id.index() >= locations.size()) return false;
+
+  const auto& location = locations[e_id.index()];
+  const auto& entities = archetypes[location.archetype]->a_entities;
+
+  return location.row < entities.size() && entities[location.row] == e_id;
+}
+
+unsigned long ArchetypeManager::locate(Entity e_id)
+{
+  if (stored(e_id))
+    return locations[e_id.index()].archetype;
+
+  if (e_id.index() >= locations.size())
+    locations.resize(e_id.index() + 1);
+
+  auto& location = locations[e_id.index()];
+  const auto& entities = archetypes[location.archetype]->a_entities;
+
+  if (location.row < entities.size() && entities[location.row].index() == e_id.index())
+    erase(location.archetype, location.row);
+
+  auto& archetype = *archetypes[0];
+  location = Location{ 0, archetype.a_entities.size() };
+  archetype.a_entities.emplace_back(e_id);
+
+  return 0;
+}
+
+unsigned long ArchetypeManager::find(const Signature& signature, unsigned long source, const std::vector<unsigned short>& excluded)
+{
+  auto itr = lookup.find(signature);
+  if (itr != lookup.end()) return itr->second;
+
+  auto archetype = std::make_shared<Archetype>(signature);
+  for (const auto& [id, column] : archetypes[source]->columns)
+  {
+    if (std::find(excluded.begin(), excluded.end(), id) != excluded.end()) continue;
+
+    archetype->columns.emplace(std::make_pair(id, column->empty()));
+  }
+
+  archetypes.emplace_back(archetype);
+  lookup.emplace(signature, archetypes.size() - 1);
+
+  return archetypes.size() - 1;
+}
+
+void ArchetypeManager::move(Entity e_id, unsigned long index)
+{
+  auto& location = locations[e_id.index()];
+  auto& source = *archetypes[location.archetype];
+  auto& target = *archetypes[index];
+
+  for (const auto& [id, column] : source.columns)
+  {
+    auto itr = target.columns.find(id);
+    if (itr == target.columns.end()) continue;
+
+    column->move(location.row, *itr->second);
+  }
+
+  unsigned long row = target.a_entities.size();
+  target.a_entities.emplace_back(e_id);
+
+  erase(location.archetype, location.row);
+  location.archetype = index;
+  location.row = row;
+}
+
+void ArchetypeManager::erase(unsigned long index, unsigned long row)
+{
+  auto& archetype = *archetypes[index];
+
+  for (const auto& [id, column] : archetype.columns)
+    column->erase(row);
+
+  Entity last = archetype.a_entities.back();
+  archetype.a_entities[row] = last;
+  archetype.a_entities.pop_back();
+
+  if (row < archetype.a_entities.size())
+    locations[last.index()].row = row;
+}
+
+} // namespace vecs
\ No newline at end of file
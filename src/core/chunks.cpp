@@ -0,0 +1,61 @@
+#include "src/core/include/chunks.hpp"
+
+#include <memory_resource>
+
+namespace vecs
+{
+
+ChunkPool::ChunkPool(std::pmr::memory_resource * upstream)
+: p_upstream(upstream)
+{}
+
+ChunkPool::~ChunkPool()
+{
+  trim();
+}
+
+void * ChunkPool::allocate(std::size_t bytes)
+{
+  if (bytes == chunk_size)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (!freeChunks.empty())
+    {
+      void * p_chunk = freeChunks.back();
+      freeChunks.pop_back();
+      return p_chunk;
+    }
+  }
+
+  return p_upstream->allocate(bytes, alignment);
+}
+
+void ChunkPool::release(void * p_chunk, std::size_t bytes)
+{
+  if (bytes != chunk_size)
+  {
+    p_upstream->deallocate(p_chunk, bytes, alignment);
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  freeChunks.emplace_back(p_chunk);
+}
+
+unsigned long ChunkPool::pooled() const
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return freeChunks.size();
+}
+
+void ChunkPool::trim()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  for (void * p_chunk : freeChunks)
+    p_upstream->deallocate(p_chunk, chunk_size, alignment);
+
+  freeChunks.clear();
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -0,0 +1,197 @@
+#include "src/core/include/commands.hpp"
+
+#include <algorithm>
+#include <string>
+
+namespace vecs
+{
+
+std::atomic<std::uint32_t> CommandBuffer::next_id = 0;
+std::atomic<std::uint64_t> CommandQueue::next_id = 0;
+
+CommandBuffer::~CommandBuffer()
+{
+  clear();
+}
+
+unsigned long CommandBuffer::size() const
+{
+  return commands.size();
+}
+
+bool CommandBuffer::empty() const
+{
+  return commands.empty();
+}
+
+Entity CommandBuffer::spawn()
+{
+  Entity e_id(spawned++, id);
+  commands.emplace_back(Command{ .type = Spawn, .e_id = e_id, .component = 0, .data = nullptr, .apply = nullptr });
+
+  return e_id;
+}
+
+void CommandBuffer::despawn(Entity e_id)
+{
+  check(e_id, "despawn");
+  commands.emplace_back(Command{ .type = Despawn, .e_id = e_id, .component = 0, .data = nullptr, .apply = nullptr });
+}
+
+void CommandBuffer::flush(EntityManager& e_manager, ComponentManager& c_manager)
+{
+  std::vector<Command> batch;
+
+  resolve(e_manager, batch);
+  apply(e_manager, c_manager, batch);
+
+  clear();
+}
+
+void CommandBuffer::clear()
+{
+  for (const auto& payload : payloads)
+    payload.destroy(payload.data);
+
+  commands.clear();
+  payloads.clear();
+  block = 0;
+  offset = 0;
+  spawned = 0;
+}
+
+std::byte * CommandBuffer::allocate(std::size_t size, std::size_t alignment)
+{
+  while (true)
+  {
+    for (; block < blocks.size(); ++block, offset = 0)
+    {
+      auto base = reinterpret_cast<std::uintptr_t>(blocks[block].data.get());
+      std::size_t start = ((base + offset + alignment - 1) & ~(alignment - 1)) - base;
+
+      if (start + size > blocks[block].size) continue;
+
+      offset = start + size;
+      return blocks[block].data.get() + start;
+    }
+
+    std::size_t bytes = std::max(block_size, size + alignment);
+    blocks.emplace_back(Block{ .data = std::make_unique<std::byte[]>(bytes), .size = bytes });
+    block = blocks.size() - 1;
+  }
+}
+
+void CommandBuffer::check(Entity e_id, const char * method) const
+{
+  if ((e_id.generation() & pending) != pending) return;
+
+  if (e_id.generation() != id)
+    throw std::runtime_error(std::string("error @ CommandBuffer::") + method + "() : pending entity from another buffer");
+
+  if (e_id.index() >= spawned)
+    throw std::runtime_error(std::string("error @ CommandBuffer::") + method + "() : pending entity from an earlier flush");
+}
+
+void CommandBuffer::resolve(EntityManager& e_manager, std::vector<Command>& batch)
+{
+  std::vector<Entity> created = e_manager.create_entities(spawned);
+
+  for (auto command : commands)
+  {
+    if (command.type == Spawn) continue;
+
+    if (command.e_id.generation() == id)
+    {
+      if (command.e_id.index() >= created.size()) continue;
+
+      command.e_id = created[command.e_id.index()];
+    }
+
+    batch.emplace_back(command);
+  }
+}
+
+void CommandBuffer::apply(EntityManager& e_manager, ComponentManager& c_manager, std::vector<Command>& batch)
+{
+  std::ranges::stable_sort(batch, [](const Command& lhs, const Command& rhs){
+    return lhs.e_id.index() != rhs.e_id.index() ? lhs.e_id.index() < rhs.e_id.index() : lhs.e_id.generation() < rhs.e_id.generation();
+  });
+
+  std::vector<unsigned short> applied;
+
+  auto first = batch.begin();
+  while (first != batch.end())
+  {
+    Entity e_id = first->e_id;
+    auto last = std::find_if(first, batch.end(), [e_id](const Command& command){ return command.e_id != e_id; });
+
+    if (!e_manager.valid(e_id))
+    {
+      first = last;
+      continue;
+    }
+
+    if (std::any_of(first, last, [](const Command& command){ return command.type == Despawn; }))
+    {
+      c_manager.clear_data(e_id);
+      e_manager.remove_entity(e_id);
+
+      first = last;
+      continue;
+    }
+
+    applied.clear();
+    for (auto command = last; command != first;)
+    {
+      --command;
+      if (std::find(applied.begin(), applied.end(), command->component) != applied.end()) continue;
+
+      command->apply(e_manager, c_manager, e_id, command->data);
+      applied.emplace_back(command->component);
+    }
+
+    first = last;
+  }
+}
+
+CommandBuffer& CommandQueue::local()
+{
+  thread_local std::vector<std::pair<std::uint64_t, CommandBuffer *>> cache;
+
+  for (const auto& [queue, buffer] : cache)
+    if (queue == id) return *buffer;
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  CommandBuffer * buffer = buffers.emplace_back(std::make_unique<CommandBuffer>()).get();
+  cache.emplace_back(id, buffer);
+
+  return *buffer;
+}
+
+unsigned long CommandQueue::size()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  unsigned long total = 0;
+  for (const auto& buffer : buffers)
+    total += buffer->size();
+
+  return total;
+}
+
+void CommandQueue::flush(EntityManager& e_manager, ComponentManager& c_manager)
+{
+  std::lock_guard<std::mutex> lock(mutex);
+
+  std::vector<CommandBuffer::Command> batch;
+  for (auto& buffer : buffers)
+    buffer->resolve(e_manager, batch);
+
+  CommandBuffer::apply(e_manager, c_manager, batch);
+
+  for (auto& buffer : buffers)
+    buffer->clear();
+}
+
+} // namespace vecs
\ No newline at end of file
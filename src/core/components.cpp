@@ -0,0 +1,206 @@
+#include "src/core/include/components.hpp"
+
+namespace vecs
+{
+
+void IComponentArray::swap()
+{}
+
+SparseArray::SparseArray(std::shared_ptr<const std::uint32_t> clock, unsigned long shift, std::pmr::memory_resource * resource)
+: ids(resource), sparse(resource), addedTicks(resource), changedTicks(resource), chunkTicks(resource), clock(std::move(clock)), shift(shift)
+{}
+
+unsigned long SparseArray::size() const
+{
+  return ids.size();
+}
+
+std::span<const Entity> SparseArray::entities() const
+{
+  return ids;
+}
+
+std::uint32_t SparseArray::chunk_tick(unsigned long index) const
+{
+  return index < chunkTicks.size() ? std::atomic_ref<std::uint32_t>(const_cast<std::uint32_t&>(chunkTicks[index])).load(std::memory_order_relaxed) : 0;
+}
+
+void SparseArray::mark(Entity e_id)
+{
+  unsigned long i = index(e_id);
+  if (i != invalid)
+    touch(i);
+}
+
+std::shared_ptr<SparseArray::Pin> SparseArray::pin()
+{
+  if (pinned == nullptr)
+    pinned = std::make_shared<Pin>();
+
+  return pinned;
+}
+
+void SparseArray::Pin::release()
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  if (!active.load(std::memory_order_acquire)) return;
+
+  preserve();
+  preserve = nullptr;
+  active.store(false, std::memory_order_release);
+}
+
+unsigned long& SparseArray::slot(Entity e_id)
+{
+  unsigned long page = e_id.index() / page_size;
+
+  if (page >= sparse.size())
+    sparse.resize(page + 1);
+
+  if (sparse[page].empty())
+    sparse[page].resize(page_size, invalid);
+
+  return sparse[page][e_id.index() % page_size];
+}
+
+void SparseArray::reserveIndex(unsigned long count)
+{
+  modify();
+
+  ids.reserve(count);
+  addedTicks.reserve(count);
+  changedTicks.reserve(count);
+}
+
+std::pair<unsigned long, bool> SparseArray::attach(Entity e_id)
+{
+  modify();
+
+  unsigned long& index = slot(e_id);
+
+  if (index != invalid)
+  {
+    if (ids[index] != e_id)
+      addedTicks[index] = now();
+
+    ids[index] = e_id;
+    changedTicks[index] = now();
+    dirty(index);
+    return { index, false };
+  }
+
+  index = ids.size();
+  ids.emplace_back(e_id);
+  addedTicks.emplace_back(now());
+  changedTicks.emplace_back(now());
+  dirty(index);
+
+  return { index, true };
+}
+
+unsigned long SparseArray::attach(std::span<const Entity> e_ids)
+{
+  modify();
+
+  unsigned long offset = ids.size();
+  reserveIndex(offset + e_ids.size());
+
+  unsigned long i = 0;
+  for (; i < e_ids.size(); ++i)
+  {
+    unsigned long& index = slot(e_ids[i]);
+    if (index != invalid) break;
+
+    index = offset + i;
+  }
+
+  ids.insert(ids.end(), e_ids.begin(), e_ids.begin() + i);
+  addedTicks.resize(addedTicks.size() + i, now());
+  changedTicks.resize(changedTicks.size() + i, now());
+
+  for (unsigned long position = offset; position < offset + i; position += 1ul << shift)
+    dirty(position);
+
+  if (i > 0) dirty(offset + i - 1);
+
+  return i;
+}
+
+void SparseArray::detach(unsigned long index)
+{
+  modify();
+
+  unsigned long last = ids.size() - 1;
+  slot(ids[index]) = invalid;
+
+  if (index != last)
+  {
+    ids[index] = ids[last];
+    addedTicks[index] = addedTicks[last];
+    changedTicks[index] = changedTicks[last];
+    slot(ids[index]) = index;
+    dirty(index);
+  }
+
+  ids.pop_back();
+  addedTicks.pop_back();
+  changedTicks.pop_back();
+}
+
+void SparseArray::touch(unsigned long first, unsigned long count)
+{
+  if (count == 0) return;
+
+  modify();
+  std::fill_n(changedTicks.begin() + first, count, now());
+  for (unsigned long chunk = first >> shift; chunk <= (first + count - 1) >> shift; ++chunk)
+    std::atomic_ref<std::uint32_t>(chunkTicks[chunk]).store(now(), std::memory_order_relaxed);
+}
+
+void SparseArray::dirty(unsigned long index)
+{
+  unsigned long chunk = index >> shift;
+  if (chunk >= chunkTicks.size())
+    chunkTicks.resize(chunk + 1, 0);
+
+  chunkTicks[chunk] = now();
+}
+
+ComponentManager::ComponentManager(std::pmr::memory_resource * resource)
+: p_resource(resource), componentArrays(resource), chunkPool(std::make_shared<ChunkPool>(resource)), clock(std::make_shared<std::uint32_t>(1))
+{}
+
+void ComponentManager::clear_data(Entity e_id)
+{
+  for (auto& components : componentArrays)
+  {
+    if (components != nullptr)
+      components->erase(e_id);
+  }
+}
+
+void ComponentManager::swap_buffers()
+{
+  for (auto& components : componentArrays)
+  {
+    if (components != nullptr)
+      components->swap();
+  }
+}
+
+void ComponentManager::trim()
+{
+  chunkPool->trim();
+}
+
+std::uint32_t ComponentManager::tick() const
+{
+  return *clock;
+}
+
+std::uint32_t ComponentManager::advance_tick()
+{
+  return ++*clock;
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -34,7 +34,7 @@ Device::QueueFamilies::QueueFamilies(const vk::raii::PhysicalDevice& vk_physical
   {
     unsigned int types = 0x0000000u;
 
-    if (family.queueFlags & vk::QueueFlagBits::eGraphics && vk_physicalDevice.getSurfaceSupportKHR(index, *vk_surface))
+    if (family.queueFlags & vk::QueueFlagBits::eGraphics && *vk_surface && vk_physicalDevice.getSurfaceSupportKHR(index, *vk_surface))
       types |= VECS_GRAPHICS_QUEUE_BIT | VECS_PRESENT_QUEUE_BIT;
 
     if (family.queueFlags & vk::QueueFlagBits::eCompute)
@@ -134,6 +134,16 @@ Device::Device(const vk::raii::Instance& vk_instance, const vecs::GUI& vecs_gui,
   queueFamilies->setQueues(vk_device);
 }
 
+Device::Device(const vk::raii::Instance& vk_instance, const void * p_next)
+{
+  vk::raii::SurfaceKHR vk_surface = nullptr;
+
+  getGPU(vk_instance, vk_surface);
+  createDevice(p_next);
+
+  queueFamilies->setQueues(vk_device);
+}
+
 const vk::raii::PhysicalDevice& Device::physical() const
 {
   return vk_physicalDevice;
@@ -169,24 +179,26 @@ void Device::getGPU(const vk::raii::Instance& vk_instance, const vk::raii::Surfa
 {
   std::queue<vk::raii::PhysicalDevice> discreteGPUs, integratedGPUs, virtualGPUs;
 
+  bool headless = !*vk_surface;
+
   vk::raii::PhysicalDevices GPUs(vk_instance);
   for (const auto& GPU : GPUs)
   {
     auto properties = GPU.getProperties();
     QueueFamilies families(GPU, vk_surface);
 
-    bool hasAllFamily = false;
+    bool hasMainFamily = false;
     for (const auto& family : families.supportedFamilies)
     {
-      if (family == FamilyType::All)
+      if (family == FamilyType::All || (headless && (family == FamilyType::Compute || family == FamilyType::Async)))
       {
-        hasAllFamily = true;
+        hasMainFamily = true;
         break;
       }
     }
-    if (!hasAllFamily) continue;
+    if (!hasMainFamily) continue;
 
-    bool supportsExtensions;
+    bool supportsExtensions = true;
     for (const auto& extension : VECS_SETTINGS.device_extensions())
     {
       supportsExtensions = false;
@@ -203,8 +215,8 @@ void Device::getGPU(const vk::raii::Instance& vk_instance, const vk::raii::Surfa
     }
     if (!supportsExtensions) continue;
 
-    if (GPU.getSurfaceFormatsKHR(*vk_surface).empty()) continue;
-    if (GPU.getSurfacePresentModesKHR(*vk_surface).empty()) continue;
+    if (!headless && GPU.getSurfaceFormatsKHR(*vk_surface).empty()) continue;
+    if (!headless && GPU.getSurfacePresentModesKHR(*vk_surface).empty()) continue;
 
     switch (properties.deviceType)
     {
@@ -15,6 +15,9 @@ Engine::Engine()
 
 Engine::~Engine()
 {
+  checkpoint.reset();
+  timestep.reset();
+  archetype_manager.reset();
   entity_manager.reset();
   component_manager.reset();
   system_manager.reset();
@@ -32,9 +35,25 @@ void Engine::load()
 
 void Engine::run()
 {
+  if (timestep == nullptr)
+    timestep = std::make_unique<Timestep>(VECS_SETTINGS.time_step(), VECS_SETTINGS.max_catch_up(), VECS_SETTINGS.frame_rate());
+
+  auto previous = std::chrono::steady_clock::now();
   while (!close_condition())
   {
     poll_gui();
+
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - previous).count();
+    previous = now;
+
+    if (VECS_SETTINGS.headless_enabled())
+      seconds = timestep->step();
+
+    timestep->advance(seconds, [this](){ step(); });
+
+    if (timestep->present(seconds))
+      render();
   }
 }
 
@@ -54,7 +73,10 @@ void Engine::createInstance()
   std::vector<const char *> layers;
   if (VECS_SETTINGS.validation_enabled()) layers.emplace_back(VK_VALIDATION_LAYER_NAME);
 
-  auto extensions = vecs_gui->extensions();
+  std::vector<const char *> extensions;
+  if (vecs_gui != nullptr)
+    extensions = vecs_gui->extensions();
+
   for (const auto& extension : vk_context.enumerateInstanceExtensionProperties())
   {
     if (std::string(extension.extensionName) == VK_KHR_PORTABILITY_ENUMERATION_EXTENSION_NAME)
@@ -84,13 +106,57 @@ bool Engine::close_condition()
   return should_close();
 }
 
+void Engine::step()
+{
+  if (archetype_manager != nullptr)
+  {
+    system_manager->update(archetype_manager);
+    return;
+  }
+
+  system_manager->update(component_manager, *entity_manager);
+  component_manager->swap_buffers();
+
+  if (checkpoint != nullptr)
+    checkpoint->update(*entity_manager, *component_manager);
+}
+
+void Engine::render()
+{}
+
 bool Engine::should_close() const
 {
-  return vecs_gui->shouldClose();
+  if (VECS_SETTINGS.max_steps() != 0 && step_count() >= VECS_SETTINGS.max_steps())
+    return true;
+
+  if (VECS_SETTINGS.max_time() > 0.0 && simulation_time() >= VECS_SETTINGS.max_time() - VECS_SETTINGS.time_step() / 2)
+    return true;
+
+  return vecs_gui != nullptr && vecs_gui->shouldClose();
+}
+
+unsigned long Engine::step_count() const
+{
+  return timestep != nullptr ? timestep->ticks() : 0;
+}
+
+double Engine::simulation_time() const
+{
+  return timestep != nullptr ? timestep->time() : 0.0;
 }
 
 void Engine::initialize(void * p_next)
 {
+  if (VECS_SETTINGS.headless_enabled())
+  {
+    if (!VECS_SETTINGS.compute_enabled())
+      return;
+
+    createInstance();
+    vecs_device = std::make_shared<Device>(vk_instance, p_next);
+    return;
+  }
+
   vecs_gui = std::make_shared<GUI>();
   createInstance();
   vecs_gui->createSurface(vk_instance);
@@ -100,7 +166,8 @@ void Engine::initialize(void * p_next)
 
 void Engine::poll_gui()
 {
-  vecs_gui->pollEvents();
+  if (vecs_gui != nullptr)
+    vecs_gui->pollEvents();
 }
 
 } // namespace vecs
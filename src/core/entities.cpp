@@ -1,93 +1,173 @@
 #include "src/core/include/entities.hpp"
 
+#include <algorithm>
+
 namespace vecs
 {
 
-EntityManager::EntityManager()
-{
-  nextID.push(0);
-}
+std::atomic<std::uint64_t> EntityManager::next_id = 0;
+
+EntityManager::EntityManager(std::pmr::memory_resource * resource)
+: signatures(resource), entities(resource), indices(resource), generations(resource), freeIndices(resource), queries(resource)
+{}
 
 unsigned long EntityManager::count() const
 {
   return signatures.size();
 }
 
-bool EntityManager::valid(unsigned long e_id) const
+bool EntityManager::valid(Entity entity) const
 {
-  if (indexMap.find(e_id) == indexMap.end()) return false;
-  
-  unsigned long index = indexMap.at(e_id);
+  if (entity.index() >= generations.size() || generations[entity.index()] != entity.generation())
+    return false;
 
-  if (idMap.find(index) == idMap.end()) return false;
-  
-  return idMap.at(index) == e_id;
+  return indices[entity.index()] != invalid;
 }
 
-void EntityManager::new_entity()
+Entity EntityManager::new_entity()
 {
-  if (count() == VECS_SETTINGS.max_entities() || valid(nextID.top())) return;
-  
-  unsigned long e_id = nextID.top();
-  unsigned long index = count();
-  
-  indexMap.emplace(std::make_pair(e_id, index));
-  idMap.emplace(std::make_pair(index, e_id));
+  if (count() == VECS_SETTINGS.max_entities()) return Entity{};
 
-  signatures.emplace_back(Signature{});
+  EntityIndex e_index = generations.size();
+  if (freeIndices.empty())
+  {
+    generations.emplace_back(0);
+    indices.emplace_back(invalid);
+  }
+  else
+  {
+    e_index = freeIndices.back();
+    freeIndices.pop_back();
+  }
+
+  Entity entity(e_index, generations[e_index]);
   
-  nextID.pop();
-  if (nextID.empty()) nextID.push(count());
+  indices[e_index] = count();
+  entities.emplace_back(entity);
+  signatures.emplace_back(Signature{});
+
+  refresh(entity);
+  return entity;
 }
 
-void EntityManager::remove_entity(unsigned long e_id)
+std::vector<Entity> EntityManager::create_entities(unsigned long count, const Signature& signature)
 {
-  if (count() == 0 || !valid(e_id)) return;
+  unsigned long available = VECS_SETTINGS.max_entities() > this->count() ? VECS_SETTINGS.max_entities() - this->count() : 0;
+  count = std::min(count, available);
 
-  unsigned long index = indexMap.at(e_id);
+  std::vector<Entity> created;
+  created.reserve(count);
 
-  indexMap.erase(e_id);
-  idMap.erase(index);
-  
-  for (unsigned long i = index + 1; i < count(); ++i)
+  unsigned long recycled = std::min(count, freeIndices.size());
+  for (unsigned long i = 0; i < recycled; ++i)
   {
-    unsigned long id = idMap.at(i);
-
-    idMap.erase(i);
-    indexMap.erase(id);
+    EntityIndex e_index = freeIndices.back();
+    freeIndices.pop_back();
 
-    indexMap.emplace(std::make_pair(id, i - 1));
-    idMap.emplace(std::make_pair(i - 1, id));
+    created.emplace_back(e_index, generations[e_index]);
   }
 
-  signatures.erase(signatures.begin() + index);
+  unsigned long first = generations.size();
+  generations.resize(first + count - recycled, 0);
+  indices.resize(first + count - recycled, invalid);
 
-  if (count() == 0)
+  for (unsigned long e_index = first; e_index < generations.size(); ++e_index)
+    created.emplace_back(e_index);
+
+  unsigned long index = this->count();
+  for (const auto& entity : created)
+    indices[entity.index()] = index++;
+
+  entities.insert(entities.end(), created.begin(), created.end());
+  signatures.resize(signatures.size() + count, signature);
+  ++revision;
+
+  if (!queries.empty())
   {
-    while (!nextID.empty())
-      nextID.pop();
+    for (const auto& entity : created)
+      refresh(entity);
+  }
+
+  return created;
+}
+
+void EntityManager::remove_entity(Entity entity)
+{
+  if (count() == 0 || !valid(entity)) return;
 
-    nextID.push(0);
-    return;
+  unsigned long index = indices[entity.index()];
+  unsigned long last = count() - 1;
+
+  if (index != last)
+  {
+    signatures[index] = signatures[last];
+    entities[index] = entities[last];
+    indices[entities[index].index()] = index;
   }
 
-  sort(e_id);
+  signatures.pop_back();
+  entities.pop_back();
+
+  indices[entity.index()] = invalid;
+  ++generations[entity.index()];
+  freeIndices.emplace_back(entity.index());
+  ++revision;
+
+  for (const auto& query : queries)
+    query->erase(entity);
+}
+
+View EntityManager::view(const Signature& signature, bool exactMatch) const
+{
+  return View(entities, signatures, signature, exactMatch);
 }
 
-void EntityManager::sort(unsigned long e_id)
+std::shared_ptr<Query> EntityManager::register_query(const Signature& signature, bool exactMatch)
 {
-  if (nextID.empty() || nextID.top() > e_id)
+  for (const auto& query : queries)
   {
-    nextID.push(e_id);
-    return;
+    if (query->signature() == signature && query->exact() == exactMatch)
+    {
+      ++query->q_holders;
+      return query;
+    }
   }
 
-  auto id = nextID.top();
-  nextID.pop();
+  auto query = std::make_shared<Query>(signature, exactMatch);
+  for (unsigned long index = 0; index < count(); ++index)
+  {
+    if (query->matches(signatures[index]))
+      query->insert(entities[index]);
+  }
 
-  sort(e_id);
+  query->q_holders = 1;
+  queries.emplace_back(query);
 
-  nextID.push(id);
+  return query;
+}
+
+void EntityManager::unregister_query(const std::shared_ptr<Query>& query)
+{
+  auto itr = std::find(queries.begin(), queries.end(), query);
+  if (itr == queries.end()) return;
+
+  if (--query->q_holders == 0)
+    queries.erase(itr);
+}
+
+void EntityManager::refresh(Entity entity)
+{
+  ++revision;
+
+  const auto& signature = signatures[indices[entity.index()]];
+
+  for (const auto& query : queries)
+  {
+    if (query->matches(signature))
+      query->insert(entity);
+    else
+      query->erase(entity);
+  }
 }
 
-}
\ No newline at end of file
+} // namespace vecs
\ No newline at end of file
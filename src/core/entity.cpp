@@ -0,0 +1,15 @@
+#include "src/core/include/entity.hpp"
+
+namespace vecs
+{
+
+Entity::Entity(EntityIndex index, std::uint32_t generation)
+: e_index(index), e_generation(generation)
+{}
+
+bool Entity::null() const
+{
+  return e_index == std::numeric_limits<EntityIndex>::max();
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -0,0 +1,177 @@
+#ifndef vecs_core_archetypes_hpp
+#define vecs_core_archetypes_hpp
+
+#include "src/core/include/entities.hpp"
+#include "src/core/include/entity.hpp"
+#include "src/core/include/settings.hpp"
+#include "src/core/include/signature.hpp"
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace vecs
+{
+
+class IColumn
+{
+  public:
+    IColumn() = default;
+    IColumn(const IColumn&) = default;
+    IColumn(IColumn&&) = default;
+
+    virtual ~IColumn() = default;
+
+    IColumn& operator = (const IColumn&) = default;
+    IColumn& operator = (IColumn&&) = default;
+
+    virtual unsigned long size() const = 0;
+    virtual std::shared_ptr<IColumn> empty() const = 0;
+    virtual void move(unsigned long, IColumn&) = 0;
+    virtual void erase(unsigned long) = 0;
+};
+
+template <typename T>
+class Column : public IColumn
+{
+  public:
+    Column() = default;
+    Column(const Column&) = default;
+    Column(Column&&) = default;
+
+    ~Column() = default;
+
+    Column& operator = (const Column&) = default;
+    Column& operator = (Column&&) = default;
+
+    T& at(unsigned long);
+    const T& at(unsigned long) const;
+    std::span<T> span();
+    std::span<const T> span() const;
+
+    void assign(unsigned long, const T&);
+
+    unsigned long size() const override;
+    std::shared_ptr<IColumn> empty() const override;
+    void move(unsigned long, IColumn&) override;
+    void erase(unsigned long) override;
+
+  protected:
+    std::vector<T> data;
+};
+
+class Archetype
+{
+  friend class ArchetypeManager;
+
+  public:
+    Archetype(const Signature&);
+    Archetype(const Archetype&) = delete;
+    Archetype(Archetype&&) = delete;
+
+    ~Archetype() = default;
+
+    Archetype& operator = (const Archetype&) = delete;
+    Archetype& operator = (Archetype&&) = delete;
+
+    const Signature& signature() const;
+    unsigned long size() const;
+    std::span<const Entity> entities() const;
+
+    template <typename T>
+    bool has() const;
+
+    template <typename T>
+    std::span<T> column();
+
+    template <typename T>
+    std::span<const T> column() const;
+
+  private:
+    template <typename T>
+    std::shared_ptr<Column<T>> array() const;
+
+  private:
+    Signature a_signature;
+    std::vector<Entity> a_entities;
+    std::map<unsigned short, std::shared_ptr<IColumn>> columns;
+    std::unordered_map<Signature, unsigned long, Signature::Hash> adds;
+    std::unordered_map<Signature, unsigned long, Signature::Hash> removes;
+};
+
+class ArchetypeManager
+{
+  private:
+    struct Location
+    {
+      unsigned long archetype = 0;
+      unsigned long row = 0;
+    };
+
+  public:
+    ArchetypeManager(EntityManager&);
+    ArchetypeManager(const ArchetypeManager&) = delete;
+    ArchetypeManager(ArchetypeManager&&) = delete;
+
+    ~ArchetypeManager() = default;
+
+    ArchetypeManager& operator = (const ArchetypeManager&) = delete;
+    ArchetypeManager& operator = (ArchetypeManager&&) = delete;
+
+    unsigned long count() const;
+    bool valid(Entity) const;
+
+    Entity new_entity();
+    void remove_entity(Entity);
+
+    template <typename... Tps>
+    void add_components(Entity, Tps...);
+
+    template <typename... Tps>
+    void remove_components(Entity);
+
+    template <typename T>
+    std::optional<T> retrieve(Entity) const;
+
+    template <typename T>
+    T& get(Entity);
+
+    template <typename T>
+    T * try_get(Entity);
+
+    template <typename... Tps>
+    std::vector<std::shared_ptr<Archetype>> query(bool exactMatch = false) const;
+
+    std::vector<std::shared_ptr<Archetype>> query(const Signature&, bool exactMatch = false) const;
+
+    template <typename... Tps, typename F>
+    void each(F&&, bool exactMatch = false);
+
+  protected:
+    bool stored(Entity) const;
+    unsigned long locate(Entity);
+    unsigned long find(const Signature&, unsigned long, const std::vector<unsigned short>& excluded = {});
+    void move(Entity, unsigned long);
+    void erase(unsigned long, unsigned long);
+
+    template <typename T>
+    void addColumn(unsigned long);
+
+    template <typename T>
+    void assign(Entity, T&);
+
+  protected:
+    EntityManager * e_manager = nullptr;
+    std::vector<std::shared_ptr<Archetype>> archetypes;
+    std::unordered_map<Signature, unsigned long, Signature::Hash> lookup;
+    std::vector<Location> locations;
+};
+
+} // namespace vecs
+
+#include "src/core/include/archetypes_templates.hpp"
+
+#endif // vecs_core_archetypes_hpp
\ No newline at end of file
@@ -0,0 +1,235 @@
+namespace vecs
+{
+
+template <typename T>
+T& Column<T>::at(unsigned long row)
+{
+  return data[row];
+}
+
+template <typename T>
+const T& Column<T>::at(unsigned long row) const
+{
+  return data[row];
+}
+
+template <typename T>
+std::span<T> Column<T>::span()
+{
+  return data;
+}
+
+template <typename T>
+std::span<const T> Column<T>::span() const
+{
+  return data;
+}
+
+template <typename T>
+void Column<T>::assign(unsigned long row, const T& value)
+{
+  if (row < data.size())
+  {
+    data[row] = value;
+    return;
+  }
+
+  data.emplace_back(value);
+}
+
+template <typename T>
+unsigned long Column<T>::size() const
+{
+  return data.size();
+}
+
+template <typename T>
+std::shared_ptr<IColumn> Column<T>::empty() const
+{
+  return std::make_shared<Column<T>>();
+}
+
+template <typename T>
+void Column<T>::move(unsigned long row, IColumn& target)
+{
+  static_cast<Column<T>&>(target).data.emplace_back(std::move(data[row]));
+}
+
+template <typename T>
+void Column<T>::erase(unsigned long row)
+{
+  if (row != data.size() - 1)
+    data[row] = std::move(data.back());
+
+  data.pop_back();
+}
+
+template <typename T>
+bool Archetype::has() const
+{
+  return columns.find(VECS_SETTINGS.component_id<T>()) != columns.end();
+}
+
+template <typename T>
+std::span<T> Archetype::column()
+{
+  if (!has<T>())
+    throw std::runtime_error("error @ Archetype::column<" + std::string(typeid(T).name()) + ">() : component not in archetype");
+
+  return array<T>()->span();
+}
+
+template <typename T>
+std::span<const T> Archetype::column() const
+{
+  if (!has<T>())
+    throw std::runtime_error("error @ Archetype::column<" + std::string(typeid(T).name()) + ">() : component not in archetype");
+
+  return std::static_pointer_cast<const Column<T>>(array<T>())->span();
+}
+
+template <typename T>
+std::shared_ptr<Column<T>> Archetype::array() const
+{
+  return std::static_pointer_cast<Column<T>>(columns.at(VECS_SETTINGS.component_id<T>()));
+}
+
+template <typename... Tps>
+void ArchetypeManager::add_components(Entity e_id, Tps... args)
+{
+  if (!valid(e_id)) return;
+
+  Signature components;
+  components.set<Tps...>();
+
+  unsigned long source = locate(e_id);
+  auto itr = archetypes[source]->adds.find(components);
+
+  unsigned long target = source;
+  if (itr != archetypes[source]->adds.end())
+    target = itr->second;
+  else
+  {
+    Signature signature = archetypes[source]->signature() | components;
+    if (!(signature == archetypes[source]->signature()))
+    {
+      target = find(signature, source);
+      ( addColumn<Tps>(target), ... );
+    }
+
+    archetypes[source]->adds.emplace(components, target);
+  }
+
+  if (target != source)
+    move(e_id, target);
+
+  ( assign<Tps>(e_id, args), ... );
+  e_manager->add_components<Tps...>(e_id);
+}
+
+template <typename... Tps>
+void ArchetypeManager::remove_components(Entity e_id)
+{
+  if (!valid(e_id)) return;
+
+  Signature components;
+  components.set<Tps...>();
+
+  unsigned long source = locate(e_id);
+  auto itr = archetypes[source]->removes.find(components);
+
+  unsigned long target = source;
+  if (itr != archetypes[source]->removes.end())
+    target = itr->second;
+  else
+  {
+    Signature signature = archetypes[source]->signature();
+    signature.unset<Tps...>();
+
+    if (!(signature == archetypes[source]->signature()))
+      target = find(signature, source, { VECS_SETTINGS.component_id<Tps>()... });
+
+    archetypes[source]->removes.emplace(components, target);
+  }
+
+  if (target != source)
+    move(e_id, target);
+
+  e_manager->remove_components<Tps...>(e_id);
+}
+
+template <typename T>
+std::optional<T> ArchetypeManager::retrieve(Entity e_id) const
+{
+  if (!valid(e_id) || !stored(e_id)) return std::nullopt;
+
+  const auto& location = locations[e_id.index()];
+  const auto& archetype = *archetypes[location.archetype];
+
+  if (!archetype.has<T>()) return std::nullopt;
+
+  return std::optional<T>(archetype.array<T>()->at(location.row));
+}
+
+template <typename T>
+T& ArchetypeManager::get(Entity e_id)
+{
+  T * e_data = try_get<T>(e_id);
+  if (e_data == nullptr)
+    throw std::runtime_error("error @ ArchetypeManager::get<" + std::string(typeid(T).name()) + ">() : no data for e_id");
+
+  return *e_data;
+}
+
+template <typename T>
+T * ArchetypeManager::try_get(Entity e_id)
+{
+  if (!valid(e_id) || !stored(e_id)) return nullptr;
+
+  const auto& location = locations[e_id.index()];
+  const auto& archetype = *archetypes[location.archetype];
+
+  if (!archetype.has<T>()) return nullptr;
+
+  return &archetype.array<T>()->at(location.row);
+}
+
+template <typename... Tps>
+std::vector<std::shared_ptr<Archetype>> ArchetypeManager::query(bool exactMatch) const
+{
+  Signature signature;
+  signature.set<Tps...>();
+
+  return query(signature, exactMatch);
+}
+
+template <typename... Tps, typename F>
+void ArchetypeManager::each(F&& func, bool exactMatch)
+{
+  for (const auto& archetype : query<Tps...>(exactMatch))
+  {
+    auto entities = archetype->entities();
+    auto columns = std::make_tuple(archetype->template column<Tps>()...);
+
+    for (unsigned long row = 0; row < entities.size(); ++row)
+      func(entities[row], std::get<std::span<Tps>>(columns)[row]...);
+  }
+}
+
+template <typename T>
+void ArchetypeManager::addColumn(unsigned long index)
+{
+  auto& archetype = *archetypes[index];
+  if (archetype.has<T>()) return;
+
+  archetype.columns.emplace(std::make_pair(VECS_SETTINGS.component_id<T>(), std::make_shared<Column<T>>()));
+}
+
+template <typename T>
+void ArchetypeManager::assign(Entity e_id, T& e_data)
+{
+  const auto& location = locations[e_id.index()];
+  archetypes[location.archetype]->array<T>()->assign(location.row, e_data);
+}
+
+} // namespace vecs
\ No newline at end of file
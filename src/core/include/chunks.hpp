@@ -0,0 +1,137 @@
+#ifndef vecs_core_chunks_hpp
+#define vecs_core_chunks_hpp
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#ifndef VECS_CHUNK_SIZE
+#define VECS_CHUNK_SIZE 16384
+#endif // VECS_CHUNK_SIZE
+
+namespace vecs
+{
+
+class ChunkPool
+{
+  public:
+    static constexpr std::size_t chunk_size = VECS_CHUNK_SIZE;
+    static constexpr std::size_t alignment = 64;
+
+    ChunkPool(std::pmr::memory_resource * upstream = std::pmr::get_default_resource());
+    ChunkPool(const ChunkPool&) = delete;
+    ChunkPool(ChunkPool&&) = delete;
+
+    ~ChunkPool();
+
+    ChunkPool& operator = (const ChunkPool&) = delete;
+    ChunkPool& operator = (ChunkPool&&) = delete;
+
+    void * allocate(std::size_t);
+    void release(void *, std::size_t);
+
+    unsigned long pooled() const;
+    void trim();
+
+  private:
+    std::pmr::memory_resource * p_upstream = nullptr;
+
+    mutable std::mutex mutex;
+    std::vector<void *> freeChunks;
+};
+
+template <typename T>
+class ChunkIterator
+{
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = std::remove_cv_t<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = T *;
+    using reference = T&;
+
+  public:
+    ChunkIterator() = default;
+    ChunkIterator(T * const *, unsigned long, unsigned long);
+    ChunkIterator(const ChunkIterator&) = default;
+    ChunkIterator(ChunkIterator&&) = default;
+
+    ~ChunkIterator() = default;
+
+    ChunkIterator& operator = (const ChunkIterator&) = default;
+    ChunkIterator& operator = (ChunkIterator&&) = default;
+    reference operator * () const;
+    pointer operator -> () const;
+    ChunkIterator& operator ++ ();
+    ChunkIterator operator ++ (int);
+    bool operator == (const ChunkIterator&) const;
+
+  private:
+    T * const * chunks = nullptr;
+    unsigned long index = 0;
+    unsigned long shift = 0;
+};
+
+template <typename T>
+class ChunkedArray
+{
+  public:
+    static constexpr unsigned long chunk_elements = std::bit_floor(std::max<std::size_t>(ChunkPool::chunk_size / sizeof(T), 1));
+    static constexpr unsigned long shift = std::countr_zero(chunk_elements);
+
+    ChunkedArray(std::shared_ptr<ChunkPool> pool = std::make_shared<ChunkPool>());
+    ChunkedArray(const ChunkedArray&);
+    ChunkedArray(ChunkedArray&&);
+
+    ~ChunkedArray();
+
+    ChunkedArray& operator = (const ChunkedArray&);
+    ChunkedArray& operator = (ChunkedArray&&);
+
+    T& operator [] (unsigned long);
+    const T& operator [] (unsigned long) const;
+
+    unsigned long size() const;
+    bool empty() const;
+    unsigned long chunk_count() const;
+    std::span<T> chunk(unsigned long);
+    std::span<const T> chunk(unsigned long) const;
+
+    ChunkIterator<T> begin();
+    ChunkIterator<T> end();
+    ChunkIterator<const T> begin() const;
+    ChunkIterator<const T> end() const;
+
+    void reserve(unsigned long);
+    void push_back(const T&);
+    void append(std::span<const T>);
+    void pop_back();
+    void clear();
+
+  private:
+    static constexpr std::size_t chunk_bytes = std::max(ChunkPool::chunk_size, chunk_elements * sizeof(T));
+
+    static_assert(alignof(T) <= ChunkPool::alignment, "component alignment exceeds chunk alignment");
+
+    void grow();
+    void shrink();
+    void release();
+
+  private:
+    std::shared_ptr<ChunkPool> pool;
+    std::vector<T *> chunks;
+    unsigned long count = 0;
+};
+
+} // namespace vecs
+
+#include "src/core/include/chunks_templates.hpp"
+
+#endif // vecs_core_chunks_hpp
\ No newline at end of file
@@ -0,0 +1,250 @@
+namespace vecs
+{
+
+template <typename T>
+ChunkIterator<T>::ChunkIterator(T * const * p_chunks, unsigned long i, unsigned long s)
+: chunks(p_chunks), index(i), shift(s)
+{}
+
+template <typename T>
+typename ChunkIterator<T>::reference ChunkIterator<T>::operator * () const
+{
+  return chunks[index >> shift][index & ((1ul << shift) - 1)];
+}
+
+template <typename T>
+typename ChunkIterator<T>::pointer ChunkIterator<T>::operator -> () const
+{
+  return &**this;
+}
+
+template <typename T>
+ChunkIterator<T>& ChunkIterator<T>::operator ++ ()
+{
+  ++index;
+  return *this;
+}
+
+template <typename T>
+ChunkIterator<T> ChunkIterator<T>::operator ++ (int)
+{
+  ChunkIterator itr = *this;
+  ++(*this);
+
+  return itr;
+}
+
+template <typename T>
+bool ChunkIterator<T>::operator == (const ChunkIterator& rhs) const
+{
+  return index == rhs.index;
+}
+
+template <typename T>
+ChunkedArray<T>::ChunkedArray(std::shared_ptr<ChunkPool> p_pool)
+: pool(std::move(p_pool))
+{}
+
+template <typename T>
+ChunkedArray<T>::ChunkedArray(const ChunkedArray& other)
+: pool(other.pool)
+{
+  reserve(other.count);
+
+  for (const auto& element : other)
+    push_back(element);
+}
+
+template <typename T>
+ChunkedArray<T>::ChunkedArray(ChunkedArray&& other)
+: pool(other.pool), chunks(std::move(other.chunks)), count(other.count)
+{
+  other.chunks.clear();
+  other.count = 0;
+}
+
+template <typename T>
+ChunkedArray<T>::~ChunkedArray()
+{
+  release();
+}
+
+template <typename T>
+ChunkedArray<T>& ChunkedArray<T>::operator = (const ChunkedArray& other)
+{
+  if (this == &other) return *this;
+
+  clear();
+  reserve(other.count);
+
+  for (const auto& element : other)
+    push_back(element);
+
+  return *this;
+}
+
+template <typename T>
+ChunkedArray<T>& ChunkedArray<T>::operator = (ChunkedArray&& other)
+{
+  if (this == &other) return *this;
+
+  release();
+
+  pool = other.pool;
+  chunks = std::move(other.chunks);
+  count = other.count;
+
+  other.chunks.clear();
+  other.count = 0;
+
+  return *this;
+}
+
+template <typename T>
+T& ChunkedArray<T>::operator [] (unsigned long index)
+{
+  return chunks[index >> shift][index & (chunk_elements - 1)];
+}
+
+template <typename T>
+const T& ChunkedArray<T>::operator [] (unsigned long index) const
+{
+  return chunks[index >> shift][index & (chunk_elements - 1)];
+}
+
+template <typename T>
+unsigned long ChunkedArray<T>::size() const
+{
+  return count;
+}
+
+template <typename T>
+bool ChunkedArray<T>::empty() const
+{
+  return count == 0;
+}
+
+template <typename T>
+unsigned long ChunkedArray<T>::chunk_count() const
+{
+  return (count + chunk_elements - 1) >> shift;
+}
+
+template <typename T>
+std::span<T> ChunkedArray<T>::chunk(unsigned long index)
+{
+  return std::span<T>(chunks[index], std::min(chunk_elements, count - (index << shift)));
+}
+
+template <typename T>
+std::span<const T> ChunkedArray<T>::chunk(unsigned long index) const
+{
+  return std::span<const T>(chunks[index], std::min(chunk_elements, count - (index << shift)));
+}
+
+template <typename T>
+ChunkIterator<T> ChunkedArray<T>::begin()
+{
+  return ChunkIterator<T>(chunks.data(), 0, shift);
+}
+
+template <typename T>
+ChunkIterator<T> ChunkedArray<T>::end()
+{
+  return ChunkIterator<T>(chunks.data(), count, shift);
+}
+
+template <typename T>
+ChunkIterator<const T> ChunkedArray<T>::begin() const
+{
+  return ChunkIterator<const T>(chunks.data(), 0, shift);
+}
+
+template <typename T>
+ChunkIterator<const T> ChunkedArray<T>::end() const
+{
+  return ChunkIterator<const T>(chunks.data(), count, shift);
+}
+
+template <typename T>
+void ChunkedArray<T>::reserve(unsigned long capacity)
+{
+  while ((chunks.size() << shift) < capacity)
+    grow();
+}
+
+template <typename T>
+void ChunkedArray<T>::push_back(const T& element)
+{
+  if (count == (chunks.size() << shift))
+    grow();
+
+  new (&(*this)[count]) T(element);
+  ++count;
+}
+
+template <typename T>
+void ChunkedArray<T>::append(std::span<const T> elements)
+{
+  reserve(count + elements.size());
+
+  unsigned long copied = 0;
+  while (copied < elements.size())
+  {
+    unsigned long offset = count & (chunk_elements - 1);
+    unsigned long length = std::min(chunk_elements - offset, elements.size() - copied);
+
+    std::uninitialized_copy_n(elements.begin() + copied, length, chunks[count >> shift] + offset);
+
+    copied += length;
+    count += length;
+  }
+}
+
+template <typename T>
+void ChunkedArray<T>::pop_back()
+{
+  --count;
+  std::destroy_at(&(*this)[count]);
+
+  shrink();
+}
+
+template <typename T>
+void ChunkedArray<T>::clear()
+{
+  for (unsigned long index = 0; index < count; ++index)
+    std::destroy_at(&(*this)[index]);
+
+  count = 0;
+  shrink();
+}
+
+template <typename T>
+void ChunkedArray<T>::grow()
+{
+  chunks.emplace_back(static_cast<T *>(pool->allocate(chunk_bytes)));
+}
+
+template <typename T>
+void ChunkedArray<T>::release()
+{
+  clear();
+
+  for (T * p_chunk : chunks)
+    pool->release(p_chunk, chunk_bytes);
+
+  chunks.clear();
+}
+
+template <typename T>
+void ChunkedArray<T>::shrink()
+{
+  while (chunks.size() > chunk_count() + 1)
+  {
+    pool->release(chunks.back(), chunk_bytes);
+    chunks.pop_back();
+  }
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -0,0 +1,150 @@
+#ifndef vecs_core_commands_hpp
+#define vecs_core_commands_hpp
+
+#include "src/core/include/components.hpp"
+#include "src/core/include/entities.hpp"
+#include "src/core/include/entity.hpp"
+#include "src/core/include/settings.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace vecs
+{
+
+class CommandBuffer
+{
+  friend class CommandQueue;
+
+  public:
+    CommandBuffer() = default;
+    CommandBuffer(const CommandBuffer&) = delete;
+    CommandBuffer(CommandBuffer&&) = delete;
+
+    ~CommandBuffer();
+
+    CommandBuffer& operator = (const CommandBuffer&) = delete;
+    CommandBuffer& operator = (CommandBuffer&&) = delete;
+
+    unsigned long size() const;
+    bool empty() const;
+
+    Entity spawn();
+    void despawn(Entity);
+
+    template <typename... Tps>
+    void add_components(Entity, const Tps&...);
+
+    template <typename... Tps>
+    void remove_components(Entity);
+
+    void flush(EntityManager&, ComponentManager&);
+    void clear();
+
+  private:
+    enum Type
+    {
+      Spawn,
+      Despawn,
+      Add,
+      Remove
+    };
+
+    using Apply = void (*)(EntityManager&, ComponentManager&, Entity, const std::byte *);
+    using Destroy = void (*)(std::byte *);
+
+    struct Command
+    {
+      Type type;
+      Entity e_id;
+      unsigned short component;
+      const std::byte * data;
+      Apply apply;
+    };
+
+    struct Payload
+    {
+      std::byte * data;
+      Destroy destroy;
+    };
+
+    struct Block
+    {
+      std::unique_ptr<std::byte[]> data;
+      std::size_t size;
+    };
+
+    template <typename T>
+    void add(Entity, const T&);
+
+    template <typename T>
+    void remove(Entity);
+
+    template <typename T>
+    static void insertData(EntityManager&, ComponentManager&, Entity, const std::byte *);
+
+    template <typename T>
+    static void eraseData(EntityManager&, ComponentManager&, Entity, const std::byte *);
+
+    template <typename T>
+    static void destroyData(std::byte *);
+
+    std::byte * allocate(std::size_t, std::size_t);
+    void check(Entity, const char *) const;
+    void resolve(EntityManager&, std::vector<Command>&);
+
+    static void apply(EntityManager&, ComponentManager&, std::vector<Command>&);
+
+  private:
+    static constexpr std::uint32_t pending = 0xFFFF0000;
+    static constexpr std::size_t block_size = 4096;
+    static std::atomic<std::uint32_t> next_id;
+
+    std::uint32_t id = pending | (next_id++ & 0xFFFF);
+
+    std::vector<Command> commands;
+    std::vector<Payload> payloads;
+    std::vector<Block> blocks;
+    std::size_t block = 0;
+    std::size_t offset = 0;
+    EntityIndex spawned = 0;
+};
+
+class CommandQueue
+{
+  public:
+    CommandQueue() = default;
+    CommandQueue(const CommandQueue&) = delete;
+    CommandQueue(CommandQueue&&) = delete;
+
+    ~CommandQueue() = default;
+
+    CommandQueue& operator = (const CommandQueue&) = delete;
+    CommandQueue& operator = (CommandQueue&&) = delete;
+
+    CommandBuffer& local();
+    unsigned long size();
+
+    void flush(EntityManager&, ComponentManager&);
+
+  private:
+    static std::atomic<std::uint64_t> next_id;
+
+    std::uint64_t id = next_id++;
+
+    std::mutex mutex;
+    std::vector<std::unique_ptr<CommandBuffer>> buffers;
+};
+
+} // namespace vecs
+
+#include "src/core/include/commands_templates.hpp"
+
+#endif // vecs_core_commands_hpp
\ No newline at end of file
@@ -0,0 +1,71 @@
+namespace vecs
+{
+
+template <typename... Tps>
+void CommandBuffer::add_components(Entity e_id, const Tps&... e_data)
+{
+  ( add<Tps>(e_id, e_data), ... );
+}
+
+template <typename... Tps>
+void CommandBuffer::remove_components(Entity e_id)
+{
+  ( remove<Tps>(e_id), ... );
+}
+
+template <typename T>
+void CommandBuffer::add(Entity e_id, const T& e_data)
+{
+  check(e_id, "add_components");
+
+  std::byte * data = allocate(sizeof(T), alignof(T));
+  new (data) T(e_data);
+
+  if constexpr (!std::is_trivially_destructible_v<T>)
+    payloads.emplace_back(Payload{ .data = data, .destroy = &destroyData<T> });
+
+  commands.emplace_back(Command{
+    .type       = Add,
+    .e_id       = e_id,
+    .component  = VECS_SETTINGS.component_id<T>(),
+    .data       = data,
+    .apply      = &insertData<T>
+  });
+}
+
+template <typename T>
+void CommandBuffer::remove(Entity e_id)
+{
+  check(e_id, "remove_components");
+
+  commands.emplace_back(Command{
+    .type       = Remove,
+    .e_id       = e_id,
+    .component  = VECS_SETTINGS.component_id<T>(),
+    .data       = nullptr,
+    .apply      = &eraseData<T>
+  });
+}
+
+template <typename T>
+void CommandBuffer::insertData(EntityManager& e_manager, ComponentManager& c_manager, Entity e_id, const std::byte * data)
+{
+  c_manager.register_components<T>();
+  c_manager.update_data(e_id, *std::launder(reinterpret_cast<const T *>(data)));
+  e_manager.add_components<T>(e_id);
+}
+
+template <typename T>
+void CommandBuffer::eraseData(EntityManager& e_manager, ComponentManager& c_manager, Entity e_id, const std::byte *)
+{
+  e_manager.remove_components<T>(e_id);
+  c_manager.remove_data<T>(e_id);
+}
+
+template <typename T>
+void CommandBuffer::destroyData(std::byte * data)
+{
+  std::launder(reinterpret_cast<T *>(data))->~T();
+}
+
+} // namespace vecs
\ No newline at end of file
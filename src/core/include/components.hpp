@@ -1,9 +1,27 @@
 #ifndef vecs_core_components_hpp
 #define vecs_core_components_hpp
 
-#include <map>
+#include "src/core/include/chunks.hpp"
+#include "src/core/include/entity.hpp"
+#include "src/core/include/settings.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
 #include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace vecs
@@ -20,13 +38,76 @@ class IComponentArray
 
     IComponentArray& operator = (const IComponentArray&) = default;
     IComponentArray& operator = (IComponentArray&&) = default;
+
+    virtual void erase(Entity) = 0;
+    virtual void swap();
+};
+
+class SparseArray : public IComponentArray
+{
+  public:
+    SparseArray(std::shared_ptr<const std::uint32_t> clock = nullptr, unsigned long shift = 0, std::pmr::memory_resource * resource = std::pmr::get_default_resource());
+    SparseArray(const SparseArray&) = default;
+    SparseArray(SparseArray&&) = default;
+
+    ~SparseArray() = default;
+
+    SparseArray& operator = (const SparseArray&) = default;
+    SparseArray& operator = (SparseArray&&) = default;
+
+    bool contains(Entity) const;
+    unsigned long size() const;
+    std::span<const Entity> entities() const;
+    std::uint32_t added_tick(Entity) const;
+    std::uint32_t changed_tick(Entity) const;
+    std::uint32_t chunk_tick(unsigned long) const;
+
+    void mark(Entity);
+
+    struct Pin
+    {
+      std::mutex mutex;
+      std::atomic<bool> active = false;
+      std::function<void()> preserve;
+
+      void release();
+    };
+
+    std::shared_ptr<Pin> pin();
+
+  protected:
+    unsigned long index(Entity) const;
+    unsigned long& slot(Entity);
+    std::uint32_t now() const;
+    void modify();
+    void reserveIndex(unsigned long);
+    std::pair<unsigned long, bool> attach(Entity);
+    unsigned long attach(std::span<const Entity>);
+    void detach(unsigned long);
+    void touch(unsigned long);
+    void touch(unsigned long, unsigned long);
+    void dirty(unsigned long);
+
+  protected:
+    static constexpr unsigned long page_size = 4096;
+    static constexpr unsigned long invalid = std::numeric_limits<unsigned long>::max();
+
+    std::pmr::vector<Entity> ids;
+    std::pmr::vector<std::pmr::vector<unsigned long>> sparse;
+    std::pmr::vector<std::uint32_t> addedTicks;
+    std::pmr::vector<std::uint32_t> changedTicks;
+    std::pmr::vector<std::uint32_t> chunkTicks;
+    std::shared_ptr<const std::uint32_t> clock = nullptr;
+    std::shared_ptr<Pin> pinned = nullptr;
+    unsigned long shift = 0;
 };
 
 template <typename T>
-class ComponentArray : public IComponentArray
+class ComponentArray : public SparseArray
 {
   public:
-    ComponentArray() = default;
+    ComponentArray();
+    ComponentArray(std::shared_ptr<ChunkPool>, std::shared_ptr<const std::uint32_t>, std::pmr::memory_resource * resource = std::pmr::get_default_resource());
     ComponentArray(const ComponentArray&) = default;
     ComponentArray(ComponentArray&&) = default;
 
@@ -35,23 +116,192 @@ class ComponentArray : public IComponentArray
     ComponentArray& operator = (const ComponentArray&) = default;
     ComponentArray& operator = (ComponentArray&&) = default;
     
-    const T& at(unsigned long) const;
+    T& at(Entity);
+    const T& at(Entity) const;
+    T * find(Entity);
+    const T * find(Entity) const;
+    std::ranges::subrange<ChunkIterator<T>> components();
+    std::ranges::subrange<ChunkIterator<const T>> components() const;
+    unsigned long chunk_count() const;
+    std::span<T> chunk(unsigned long);
+    std::span<const T> chunk(unsigned long) const;
     
-    void emplace(unsigned long, T);
-    void erase(unsigned long);
+    void reserve(unsigned long);
+    void emplace(Entity, const T&);
+    void emplace(std::span<const Entity>, std::span<const T>);
+    void erase(Entity) override;
+
+    template <std::ranges::input_range R>
+    void erase(const R&);
+
+  protected:
+    ChunkedArray<T> data;
+};
+
+template <typename T>
+struct SoALayout
+{
+  static constexpr bool enabled = false;
+};
+
+template <typename V, unsigned long N>
+struct SoAFields
+{
+  static constexpr bool enabled = true;
+  static constexpr unsigned long fields = N;
+
+  using value_type = V;
+};
+
+template <typename V, std::size_t A>
+class AlignedAllocator
+{
+  public:
+    using value_type = V;
+
+    template <typename U>
+    struct rebind
+    {
+      using other = AlignedAllocator<U, A>;
+    };
+
+    AlignedAllocator() = default;
+    AlignedAllocator(const AlignedAllocator&) = default;
+    AlignedAllocator(AlignedAllocator&&) = default;
+
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, A>&) {}
+
+    ~AlignedAllocator() = default;
+
+    AlignedAllocator& operator = (const AlignedAllocator&) = default;
+    AlignedAllocator& operator = (AlignedAllocator&&) = default;
+
+    template <typename U>
+    bool operator == (const AlignedAllocator<U, A>&) const;
+
+    V * allocate(std::size_t);
+    void deallocate(V *, std::size_t);
+};
+
+template <typename T>
+class SoAComponentArray : public SparseArray
+{
+  public:
+    using value_type = typename SoALayout<T>::value_type;
+
+    static constexpr unsigned long fields = SoALayout<T>::fields;
+    static constexpr std::size_t alignment = 64;
+
+    using column_type = std::vector<value_type, AlignedAllocator<value_type, alignment>>;
+
+    SoAComponentArray();
+    SoAComponentArray(std::shared_ptr<const std::uint32_t>, std::pmr::memory_resource * resource = std::pmr::get_default_resource());
+    SoAComponentArray(const SoAComponentArray&) = default;
+    SoAComponentArray(SoAComponentArray&&) = default;
+
+    ~SoAComponentArray() = default;
+
+    SoAComponentArray& operator = (const SoAComponentArray&) = default;
+    SoAComponentArray& operator = (SoAComponentArray&&) = default;
+
+    T at(Entity) const;
+    std::span<value_type> column(unsigned long);
+    std::span<const value_type> column(unsigned long) const;
+
+    void reserve(unsigned long);
+    void emplace(Entity, const T&);
+    void emplace(std::span<const Entity>, std::span<const T>);
+    void erase(Entity) override;
+
+    template <std::ranges::input_range R>
+    void erase(const R&);
+
+  protected:
+    static_assert(std::is_trivially_copyable_v<T>, "SoA components must be trivially copyable");
+    static_assert(sizeof(T) == fields * sizeof(value_type), "SoA components must contain exactly their fields");
+
+    std::array<column_type, fields> columns;
+};
+
+template <typename T>
+struct BufferLayout
+{
+  static constexpr bool enabled = false;
+};
+
+struct DoubleBuffered
+{
+  static constexpr bool enabled = true;
+};
+
+template <typename T>
+class BufferedComponentArray : public SparseArray
+{
+  public:
+    BufferedComponentArray();
+    BufferedComponentArray(std::shared_ptr<ChunkPool>, std::shared_ptr<const std::uint32_t>, std::pmr::memory_resource * resource = std::pmr::get_default_resource());
+    BufferedComponentArray(const BufferedComponentArray&) = default;
+    BufferedComponentArray(BufferedComponentArray&&) = default;
+
+    ~BufferedComponentArray() = default;
+
+    BufferedComponentArray& operator = (const BufferedComponentArray&) = default;
+    BufferedComponentArray& operator = (BufferedComponentArray&&) = default;
+
+    const T& at(Entity) const;
+    const T * find(Entity) const;
+    T& back(Entity);
+    unsigned long chunk_count() const;
+    std::span<const T> chunk(unsigned long) const;
+    std::span<T> back_chunk(unsigned long);
+
+    void reserve(unsigned long);
+    void emplace(Entity, const T&);
+    void emplace(std::span<const Entity>, std::span<const T>);
+    void swap() override;
+    void erase(Entity) override;
+
+    template <std::ranges::input_range R>
+    void erase(const R&);
 
   protected:
-    bool valid(unsigned long) const;
+    void written(unsigned long);
 
   protected:
-    std::vector<T> data;
-    std::map<unsigned long, unsigned long> indexMap;
+    std::array<ChunkedArray<T>, 2> buffers;
+    unsigned long current = 0;
+    std::pmr::vector<std::uint32_t> backChunks;
+};
+
+template <typename T>
+using ComponentStorage = std::conditional_t<SoALayout<T>::enabled, SoAComponentArray<T>, std::conditional_t<BufferLayout<T>::enabled, BufferedComponentArray<T>, ComponentArray<T>>>;
+
+class ComponentManager;
+
+template <typename T>
+struct Added
+{
+  std::uint32_t since = 0;
+
+  bool operator () (const ComponentManager&, Entity) const;
+};
+
+template <typename T>
+struct Changed
+{
+  std::uint32_t since = 0;
+
+  bool operator () (const ComponentManager&, Entity) const;
 };
 
 class ComponentManager
 {
+  friend class Checkpoint;
+  friend class Snapshot;
+
   public:
-    ComponentManager() = default;
+    ComponentManager(std::pmr::memory_resource * resource = std::pmr::get_default_resource());
     ComponentManager(const ComponentManager&) = delete;
     ComponentManager(ComponentManager&&) = delete;
 
@@ -67,16 +317,78 @@ class ComponentManager
     void unregister_components();
 
     template <typename... Tps>
-    void update_data(unsigned long, Tps...);
+    void update_data(Entity, const Tps&...);
+
+    template <typename T>
+    void update_data(std::span<const Entity>, std::span<const T>);
+
+    template <typename T, typename F>
+    void generate_data(std::span<const Entity>, F&&);
 
     template <typename... Tps>
-    void remove_data(unsigned long);
+    void remove_data(Entity);
+
+    template <typename... Tps, std::ranges::input_range R>
+    void remove_data(const R&);
+
+    void clear_data(Entity);
+    void trim();
+
+    std::uint32_t tick() const;
+    std::uint32_t advance_tick();
+
+    template <typename T>
+    std::optional<T> retrieve(Entity);
+
+    template <typename T>
+    T& get(Entity);
+
+    template <typename T>
+    const T& get(Entity) const;
+
+    template <typename T>
+    T * try_get(Entity);
+
+    template <typename T>
+    const T * try_get(Entity) const;
+
+    template <typename T>
+    SoAComponentArray<T> * columns();
+
+    template <typename T>
+    const SoAComponentArray<T> * columns() const;
+
+    template <typename T>
+    const T& front(Entity) const;
+
+    template <typename T>
+    T& back(Entity);
+
+    template <typename T>
+    BufferedComponentArray<T> * buffers();
+
+    template <typename T>
+    const BufferedComponentArray<T> * buffers() const;
 
     template <typename T>
-    std::optional<T> retrieve(unsigned long);
+    const ComponentStorage<T> * storage() const;
+
+    template <typename... Tps>
+    void swap_buffers();
+
+    void swap_buffers();
 
     template <typename T>
     bool registered() const;
+
+    template <typename T>
+    bool added(Entity, std::uint32_t) const;
+
+    template <typename T>
+    bool changed(Entity, std::uint32_t) const;
+
+    template <std::ranges::input_range R, typename... Fs>
+    auto filter(const R&, Fs...) const;
   
   protected:
     template <typename T>
@@ -86,16 +398,28 @@ class ComponentManager
     void unregisterComponent();
 
     template <typename T>
-    void update(unsigned long, T&);
+    void swapBuffer();
+
+    template <typename T>
+    void update(Entity, const T&);
+
+    template <typename T>
+    void remove(Entity);
+
+    template <typename T, std::ranges::input_range R>
+    void remove(const R&);
 
     template <typename T>
-    void remove(unsigned long);
+    std::shared_ptr<ComponentStorage<T>> array() const;
 
     template <typename T>
-    std::shared_ptr<ComponentArray<T>> array() const;
+    ComponentStorage<T> * lookup() const;
 
   protected:
-    std::map<const char *, std::shared_ptr<IComponentArray>> componentMap;
+    std::pmr::memory_resource * p_resource = nullptr;
+    std::pmr::vector<std::shared_ptr<IComponentArray>> componentArrays;
+    std::shared_ptr<ChunkPool> chunkPool = nullptr;
+    std::shared_ptr<std::uint32_t> clock = nullptr;
 
 };
 
@@ -1,41 +1,468 @@
 namespace vecs
 {
 
+inline bool SparseArray::contains(Entity e_id) const
+{
+  return index(e_id) != invalid;
+}
+
+inline std::uint32_t SparseArray::added_tick(Entity e_id) const
+{
+  unsigned long i = index(e_id);
+  return i == invalid ? 0 : addedTicks[i];
+}
+
+inline std::uint32_t SparseArray::changed_tick(Entity e_id) const
+{
+  unsigned long i = index(e_id);
+  return i == invalid ? 0 : std::atomic_ref<std::uint32_t>(const_cast<std::uint32_t&>(changedTicks[i])).load(std::memory_order_relaxed);
+}
+
+inline unsigned long SparseArray::index(Entity e_id) const
+{
+  unsigned long page = e_id.index() / page_size;
+  if (page >= sparse.size() || sparse[page].empty()) return invalid;
+
+  unsigned long i = sparse[page][e_id.index() % page_size];
+  return i != invalid && ids[i] == e_id ? i : invalid;
+}
+
+inline std::uint32_t SparseArray::now() const
+{
+  return clock == nullptr ? 0 : *clock;
+}
+
+inline void SparseArray::modify()
+{
+  if (pinned != nullptr && pinned->active.load(std::memory_order_acquire))
+    pinned->release();
+}
+
+inline void SparseArray::touch(unsigned long index)
+{
+  modify();
+
+  std::atomic_ref<std::uint32_t>(changedTicks[index]).store(now(), std::memory_order_relaxed);
+  std::atomic_ref<std::uint32_t>(chunkTicks[index >> shift]).store(now(), std::memory_order_relaxed);
+}
+
+template <typename T>
+ComponentArray<T>::ComponentArray()
+: SparseArray(nullptr, ChunkedArray<T>::shift)
+{}
+
+template <typename T>
+ComponentArray<T>::ComponentArray(std::shared_ptr<ChunkPool> pool, std::shared_ptr<const std::uint32_t> clock, std::pmr::memory_resource * resource)
+: SparseArray(std::move(clock), ChunkedArray<T>::shift, resource), data(std::move(pool))
+{}
+
+template <typename T>
+T& ComponentArray<T>::at(Entity e_id)
+{
+  T * e_data = find(e_id);
+  if (e_data == nullptr)
+    throw std::runtime_error("error @ ComponentArray<" + std::string(typeid(T).name()) + ">::at() : invalid e_id");
+
+  return *e_data;
+}
+
 template <typename T>
-const T& ComponentArray<T>::at(unsigned long e_id) const
+const T& ComponentArray<T>::at(Entity e_id) const
 {
-  if (!valid(e_id))
+  const T * e_data = find(e_id);
+  if (e_data == nullptr)
     throw std::runtime_error("error @ ComponentArray<" + std::string(typeid(T).name()) + ">::at() : invalid e_id");
   
-  return data[indexMap.at(e_id)];
+  return *e_data;
+}
+
+template <typename T>
+T * ComponentArray<T>::find(Entity e_id)
+{
+  unsigned long i = index(e_id);
+  if (i == invalid) return nullptr;
+
+  touch(i);
+  return &data[i];
+}
+
+template <typename T>
+const T * ComponentArray<T>::find(Entity e_id) const
+{
+  unsigned long i = index(e_id);
+  return i == invalid ? nullptr : &data[i];
+}
+
+template <typename T>
+std::ranges::subrange<ChunkIterator<T>> ComponentArray<T>::components()
+{
+  touch(0, size());
+  return std::ranges::subrange(data.begin(), data.end());
+}
+
+template <typename T>
+std::ranges::subrange<ChunkIterator<const T>> ComponentArray<T>::components() const
+{
+  return std::ranges::subrange(data.begin(), data.end());
+}
+
+template <typename T>
+unsigned long ComponentArray<T>::chunk_count() const
+{
+  return data.chunk_count();
+}
+
+template <typename T>
+std::span<T> ComponentArray<T>::chunk(unsigned long index)
+{
+  std::span<T> components = data.chunk(index);
+  touch(index << shift, components.size());
+
+  return components;
+}
+
+template <typename T>
+std::span<const T> ComponentArray<T>::chunk(unsigned long index) const
+{
+  return data.chunk(index);
+}
+
+template <typename T>
+void ComponentArray<T>::reserve(unsigned long count)
+{
+  reserveIndex(count);
+  data.reserve(count);
+}
+
+template <typename T>
+void ComponentArray<T>::emplace(Entity e_id, const T& e_data)
+{
+  auto [index, inserted] = attach(e_id);
+
+  if (inserted)
+    data.push_back(e_data);
+  else
+    data[index] = e_data;
+}
+
+template <typename T>
+void ComponentArray<T>::emplace(std::span<const Entity> e_ids, std::span<const T> e_data)
+{
+  unsigned long count = std::min(e_ids.size(), e_data.size());
+  data.reserve(data.size() + count);
+
+  unsigned long i = attach(e_ids.first(count));
+  data.append(e_data.first(i));
+
+  for (; i < count; ++i)
+    emplace(e_ids[i], e_data[i]);
+}
+
+template <typename T>
+void ComponentArray<T>::erase(Entity e_id)
+{
+  unsigned long i = index(e_id);
+  if (i == invalid) return;
+
+  detach(i);
+
+  unsigned long last = data.size() - 1;
+  if (i != last)
+    data[i] = std::move(data[last]);
+
+  data.pop_back();
+}
+
+template <typename T>
+template <std::ranges::input_range R>
+void ComponentArray<T>::erase(const R& e_ids)
+{
+  for (Entity e_id : e_ids)
+    erase(e_id);
+}
+
+template <typename V, std::size_t A>
+template <typename U>
+bool AlignedAllocator<V, A>::operator == (const AlignedAllocator<U, A>&) const
+{
+  return true;
+}
+
+template <typename V, std::size_t A>
+V * AlignedAllocator<V, A>::allocate(std::size_t count)
+{
+  return static_cast<V *>(::operator new(count * sizeof(V), std::align_val_t(A)));
+}
+
+template <typename V, std::size_t A>
+void AlignedAllocator<V, A>::deallocate(V * p_data, std::size_t)
+{
+  ::operator delete(p_data, std::align_val_t(A));
+}
+
+template <typename T>
+SoAComponentArray<T>::SoAComponentArray()
+: SparseArray(nullptr, ChunkedArray<T>::shift)
+{}
+
+template <typename T>
+SoAComponentArray<T>::SoAComponentArray(std::shared_ptr<const std::uint32_t> clock, std::pmr::memory_resource * resource)
+: SparseArray(std::move(clock), ChunkedArray<T>::shift, resource)
+{}
+
+template <typename T>
+T SoAComponentArray<T>::at(Entity e_id) const
+{
+  unsigned long i = index(e_id);
+  if (i == invalid)
+    throw std::runtime_error("error @ SoAComponentArray<" + std::string(typeid(T).name()) + ">::at() : invalid e_id");
+
+  std::array<value_type, fields> values;
+  for (unsigned long field = 0; field < fields; ++field)
+    values[field] = columns[field][i];
+
+  return std::bit_cast<T>(values);
+}
+
+template <typename T>
+std::span<typename SoAComponentArray<T>::value_type> SoAComponentArray<T>::column(unsigned long field)
+{
+  std::span<value_type> values = columns.at(field);
+  touch(0, size());
+
+  return values;
+}
+
+template <typename T>
+std::span<const typename SoAComponentArray<T>::value_type> SoAComponentArray<T>::column(unsigned long field) const
+{
+  return columns.at(field);
+}
+
+template <typename T>
+void SoAComponentArray<T>::reserve(unsigned long count)
+{
+  reserveIndex(count);
+
+  for (auto& column : columns)
+    column.reserve(count);
+}
+
+template <typename T>
+void SoAComponentArray<T>::emplace(Entity e_id, const T& e_data)
+{
+  auto values = std::bit_cast<std::array<value_type, fields>>(e_data);
+  auto [index, inserted] = attach(e_id);
+
+  for (unsigned long field = 0; field < fields; ++field)
+  {
+    if (inserted)
+      columns[field].emplace_back(values[field]);
+    else
+      columns[field][index] = values[field];
+  }
+}
+
+template <typename T>
+void SoAComponentArray<T>::emplace(std::span<const Entity> e_ids, std::span<const T> e_data)
+{
+  unsigned long count = std::min(e_ids.size(), e_data.size());
+  reserve(size() + count);
+
+  unsigned long i = attach(e_ids.first(count));
+  for (unsigned long field = 0; field < fields; ++field)
+  {
+    for (const T& element : e_data.first(i))
+      columns[field].emplace_back(std::bit_cast<std::array<value_type, fields>>(element)[field]);
+  }
+
+  for (; i < count; ++i)
+    emplace(e_ids[i], e_data[i]);
+}
+
+template <typename T>
+void SoAComponentArray<T>::erase(Entity e_id)
+{
+  unsigned long i = index(e_id);
+  if (i == invalid) return;
+
+  detach(i);
+
+  for (auto& column : columns)
+  {
+    column[i] = column.back();
+    column.pop_back();
+  }
+}
+
+template <typename T>
+template <std::ranges::input_range R>
+void SoAComponentArray<T>::erase(const R& e_ids)
+{
+  for (Entity e_id : e_ids)
+    erase(e_id);
+}
+
+template <typename T>
+BufferedComponentArray<T>::BufferedComponentArray()
+: SparseArray(nullptr, ChunkedArray<T>::shift)
+{}
+
+template <typename T>
+BufferedComponentArray<T>::BufferedComponentArray(std::shared_ptr<ChunkPool> pool, std::shared_ptr<const std::uint32_t> clock, std::pmr::memory_resource * resource)
+: SparseArray(std::move(clock), ChunkedArray<T>::shift, resource), buffers{ ChunkedArray<T>(pool), ChunkedArray<T>(pool) }, backChunks(resource)
+{}
+
+template <typename T>
+const T& BufferedComponentArray<T>::at(Entity e_id) const
+{
+  const T * e_data = find(e_id);
+  if (e_data == nullptr)
+    throw std::runtime_error("error @ BufferedComponentArray<" + std::string(typeid(T).name()) + ">::at() : invalid e_id");
+
+  return *e_data;
 }
 
 template <typename T>
-void ComponentArray<T>::emplace(unsigned long e_id, T e_data)
+const T * BufferedComponentArray<T>::find(Entity e_id) const
 {
-  if (valid(e_id))
+  unsigned long i = index(e_id);
+  return i == invalid ? nullptr : &buffers[current][i];
+}
+
+template <typename T>
+T& BufferedComponentArray<T>::back(Entity e_id)
+{
+  unsigned long i = index(e_id);
+  if (i == invalid)
+    throw std::runtime_error("error @ BufferedComponentArray<" + std::string(typeid(T).name()) + ">::back() : invalid e_id");
+
+  touch(i);
+  written(i >> shift);
+  return buffers[current ^ 1][i];
+}
+
+template <typename T>
+unsigned long BufferedComponentArray<T>::chunk_count() const
+{
+  return buffers[current].chunk_count();
+}
+
+template <typename T>
+std::span<const T> BufferedComponentArray<T>::chunk(unsigned long index) const
+{
+  return buffers[current].chunk(index);
+}
+
+template <typename T>
+std::span<T> BufferedComponentArray<T>::back_chunk(unsigned long index)
+{
+  std::span<T> components = buffers[current ^ 1].chunk(index);
+  touch(index << shift, components.size());
+  written(index);
+
+  return components;
+}
+
+template <typename T>
+void BufferedComponentArray<T>::reserve(unsigned long count)
+{
+  reserveIndex(count);
+
+  for (auto& buffer : buffers)
+    buffer.reserve(count);
+}
+
+template <typename T>
+void BufferedComponentArray<T>::emplace(Entity e_id, const T& e_data)
+{
+  auto [index, inserted] = attach(e_id);
+
+  for (auto& buffer : buffers)
   {
-    data[indexMap.at(e_id)] = e_data;
-    return;
+    if (inserted)
+      buffer.push_back(e_data);
+    else
+      buffer[index] = e_data;
   }
 
-  indexMap.emplace(std::make_pair(e_id, data.size()));
-  data.emplace_back(e_data);
+  if ((index >> shift) >= backChunks.size())
+    backChunks.resize((index >> shift) + 1, 0);
 }
 
 template <typename T>
-void ComponentArray<T>::erase(unsigned long e_id)
+void BufferedComponentArray<T>::emplace(std::span<const Entity> e_ids, std::span<const T> e_data)
 {
-  if (!valid(e_id)) return;
+  unsigned long count = std::min(e_ids.size(), e_data.size());
+  reserve(size() + count);
 
-  data.erase(data.begin() + indexMap.at(e_id));
-  indexMap.erase(e_id);
+  for (unsigned long i = 0; i < count; ++i)
+    emplace(e_ids[i], e_data[i]);
 }
 
 template <typename T>
-bool ComponentArray<T>::valid(unsigned long e_id) const
+void BufferedComponentArray<T>::swap()
 {
-  return indexMap.find(e_id) != indexMap.end();
+  modify();
+  current ^= 1;
+
+  unsigned long count = std::min<unsigned long>(backChunks.size(), buffers[current].chunk_count());
+  for (unsigned long chunk = 0; chunk < count; ++chunk)
+  {
+    if (backChunks[chunk] == 0) continue;
+
+    std::ranges::copy(buffers[current].chunk(chunk), buffers[current ^ 1].chunk(chunk).begin());
+  }
+
+  std::ranges::fill(backChunks, 0);
+  std::fill_n(chunkTicks.begin(), buffers[current].chunk_count(), now());
+}
+
+template <typename T>
+void BufferedComponentArray<T>::erase(Entity e_id)
+{
+  unsigned long i = index(e_id);
+  if (i == invalid) return;
+
+  unsigned long last = size() - 1;
+  detach(i);
+
+  if (i != last)
+    written(i >> shift);
+
+  for (auto& buffer : buffers)
+  {
+    if (i != last)
+      buffer[i] = std::move(buffer[last]);
+
+    buffer.pop_back();
+  }
+}
+
+template <typename T>
+template <std::ranges::input_range R>
+void BufferedComponentArray<T>::erase(const R& e_ids)
+{
+  for (Entity e_id : e_ids)
+    erase(e_id);
+}
+
+template <typename T>
+void BufferedComponentArray<T>::written(unsigned long chunk)
+{
+  std::atomic_ref<std::uint32_t>(backChunks[chunk]).store(1, std::memory_order_relaxed);
+}
+
+template <typename T>
+bool Added<T>::operator () (const ComponentManager& c_manager, Entity e_id) const
+{
+  return c_manager.template added<T>(e_id, since);
+}
+
+template <typename T>
+bool Changed<T>::operator () (const ComponentManager& c_manager, Entity e_id) const
+{
+  return c_manager.template changed<T>(e_id, since);
 }
 
 template <typename... Tps>
@@ -51,27 +478,179 @@ void ComponentManager::unregister_components()
 }
 
 template <typename... Tps>
-void ComponentManager::update_data(unsigned long e_id, Tps... args)
+void ComponentManager::update_data(Entity e_id, const Tps&... args)
 {
   ( update<Tps>(e_id, args), ... );
 }
 
+template <typename T>
+void ComponentManager::update_data(std::span<const Entity> e_ids, std::span<const T> e_data)
+{
+  auto * components = lookup<T>();
+  if (components == nullptr) return;
+
+  components->emplace(e_ids, e_data);
+}
+
+template <typename T, typename F>
+void ComponentManager::generate_data(std::span<const Entity> e_ids, F&& f)
+{
+  auto * components = lookup<T>();
+  if (components == nullptr) return;
+
+  components->reserve(components->size() + e_ids.size());
+  for (unsigned long i = 0; i < e_ids.size(); ++i)
+    components->emplace(e_ids[i], f(i));
+}
+
 template <typename... Tps>
-void ComponentManager::remove_data(unsigned long e_id)
+void ComponentManager::remove_data(Entity e_id)
 {
   ( remove<Tps>(e_id), ... );
 }
 
+template <typename... Tps, std::ranges::input_range R>
+void ComponentManager::remove_data(const R& e_ids)
+{
+  ( remove<Tps>(e_ids), ... );
+}
+
+template <typename T>
+std::optional<T> ComponentManager::retrieve(Entity e_id)
+{
+  return registered<T>() ? std::optional<T>(std::as_const(*array<T>()).at(e_id)) : std::nullopt;
+}
+
+template <typename T>
+T& ComponentManager::get(Entity e_id)
+{
+  T * e_data = try_get<T>(e_id);
+  if (e_data == nullptr)
+    throw std::runtime_error("error @ ComponentManager::get<" + std::string(typeid(T).name()) + ">() : no data for e_id");
+
+  return *e_data;
+}
+
+template <typename T>
+const T& ComponentManager::get(Entity e_id) const
+{
+  const T * e_data = try_get<T>(e_id);
+  if (e_data == nullptr)
+    throw std::runtime_error("error @ ComponentManager::get<" + std::string(typeid(T).name()) + ">() : no data for e_id");
+
+  return *e_data;
+}
+
+template <typename T>
+T * ComponentManager::try_get(Entity e_id)
+{
+  static_assert(!SoALayout<T>::enabled, "SoA components are accessed through columns()");
+  static_assert(!BufferLayout<T>::enabled, "double-buffered components are accessed through front() and back()");
+
+  auto * components = lookup<T>();
+  return components == nullptr ? nullptr : components->find(e_id);
+}
+
+template <typename T>
+const T * ComponentManager::try_get(Entity e_id) const
+{
+  static_assert(!SoALayout<T>::enabled, "SoA components are accessed through columns()");
+  static_assert(!BufferLayout<T>::enabled, "double-buffered components are accessed through front() and back()");
+
+  const auto * components = lookup<T>();
+  return components == nullptr ? nullptr : components->find(e_id);
+}
+
+template <typename T>
+SoAComponentArray<T> * ComponentManager::columns()
+{
+  static_assert(SoALayout<T>::enabled, "columns() requires an SoA component");
+
+  return lookup<T>();
+}
+
+template <typename T>
+const SoAComponentArray<T> * ComponentManager::columns() const
+{
+  static_assert(SoALayout<T>::enabled, "columns() requires an SoA component");
+
+  return lookup<T>();
+}
+
+template <typename T>
+const T& ComponentManager::front(Entity e_id) const
+{
+  const auto * components = buffers<T>();
+  const T * e_data = components == nullptr ? nullptr : components->find(e_id);
+  if (e_data == nullptr)
+    throw std::runtime_error("error @ ComponentManager::front<" + std::string(typeid(T).name()) + ">() : no data for e_id");
+
+  return *e_data;
+}
+
+template <typename T>
+T& ComponentManager::back(Entity e_id)
+{
+  auto * components = buffers<T>();
+  if (components == nullptr || !components->contains(e_id))
+    throw std::runtime_error("error @ ComponentManager::back<" + std::string(typeid(T).name()) + ">() : no data for e_id");
+
+  return components->back(e_id);
+}
+
 template <typename T>
-std::optional<T> ComponentManager::retrieve(unsigned long e_id)
+BufferedComponentArray<T> * ComponentManager::buffers()
 {
-  return registered<T>() ? std::optional<T>(array<T>()->at(e_id)) : std::nullopt;
+  static_assert(BufferLayout<T>::enabled, "buffers() requires a double-buffered component");
+
+  return lookup<T>();
+}
+
+template <typename T>
+const BufferedComponentArray<T> * ComponentManager::buffers() const
+{
+  static_assert(BufferLayout<T>::enabled, "buffers() requires a double-buffered component");
+
+  return lookup<T>();
+}
+
+template <typename T>
+const ComponentStorage<T> * ComponentManager::storage() const
+{
+  return lookup<T>();
+}
+
+template <typename... Tps>
+void ComponentManager::swap_buffers()
+{
+  ( swapBuffer<Tps>(), ... );
 }
 
 template <typename T>
 bool ComponentManager::registered() const
 {
-  return componentMap.find(typeid(T).name()) != componentMap.end();
+  unsigned short id = VECS_SETTINGS.component_id<T>();
+  return id < componentArrays.size() && componentArrays[id] != nullptr;
+}
+
+template <typename T>
+bool ComponentManager::added(Entity e_id, std::uint32_t since) const
+{
+  const auto * components = lookup<T>();
+  return components != nullptr && components->added_tick(e_id) > since;
+}
+
+template <typename T>
+bool ComponentManager::changed(Entity e_id, std::uint32_t since) const
+{
+  const auto * components = lookup<T>();
+  return components != nullptr && components->changed_tick(e_id) > since;
+}
+
+template <std::ranges::input_range R, typename... Fs>
+auto ComponentManager::filter(const R& e_ids, Fs... filters) const
+{
+  return std::views::all(e_ids) | std::views::filter([this, filters...](Entity e_id) { return ( filters(*this, e_id) && ... ); });
 }
 
 template <typename T>
@@ -79,7 +658,20 @@ void ComponentManager::registerComponent()
 {
   if (registered<T>()) return;
 
-  componentMap.emplace(std::make_pair(typeid(T).name(), std::make_shared<ComponentArray<T>>()));
+  unsigned short id = VECS_SETTINGS.component_id<T>();
+  if (id >= componentArrays.size())
+    componentArrays.resize(id + 1);
+
+  static_assert(!(SoALayout<T>::enabled && BufferLayout<T>::enabled), "a component cannot be both SoA and double-buffered");
+
+  std::pmr::polymorphic_allocator<ComponentStorage<T>> allocator(p_resource);
+
+  if constexpr (SoALayout<T>::enabled)
+    componentArrays[id] = std::allocate_shared<SoAComponentArray<T>>(allocator, clock, p_resource);
+  else if constexpr (BufferLayout<T>::enabled)
+    componentArrays[id] = std::allocate_shared<BufferedComponentArray<T>>(allocator, chunkPool, clock, p_resource);
+  else
+    componentArrays[id] = std::allocate_shared<ComponentArray<T>>(allocator, chunkPool, clock, p_resource);
 }
 
 template <typename T>
@@ -87,29 +679,54 @@ void ComponentManager::unregisterComponent()
 {
   if (!registered<T>()) return;
 
-  componentMap.erase(typeid(T).name());
+  componentArrays[VECS_SETTINGS.component_id<T>()].reset();
 }
 
 template <typename T>
-void ComponentManager::update(unsigned long e_id, T& e_data)
+void ComponentManager::swapBuffer()
 {
-  if (!registered<T>()) return;
+  auto * components = buffers<T>();
+  if (components == nullptr) return;
+
+  components->swap();
+}
+
+template <typename T>
+void ComponentManager::update(Entity e_id, const T& e_data)
+{
+  auto * components = lookup<T>();
+  if (components == nullptr) return;
   
-  array<T>()->emplace(e_id, e_data);
+  components->emplace(e_id, e_data);
 }
 
 template <typename T>
-void ComponentManager::remove(unsigned long e_id)
+void ComponentManager::remove(Entity e_id)
 {
   if (!registered<T>()) return;
   
   array<T>()->erase(e_id);
 }
 
+template <typename T, std::ranges::input_range R>
+void ComponentManager::remove(const R& e_ids)
+{
+  if (!registered<T>()) return;
+
+  array<T>()->erase(e_ids);
+}
+
+template <typename T>
+std::shared_ptr<ComponentStorage<T>> ComponentManager::array() const
+{
+  return std::static_pointer_cast<ComponentStorage<T>>(componentArrays.at(VECS_SETTINGS.component_id<T>()));
+}
+
 template <typename T>
-std::shared_ptr<ComponentArray<T>> ComponentManager::array() const
+ComponentStorage<T> * ComponentManager::lookup() const
 {
-  return std::static_pointer_cast<ComponentArray<T>>(componentMap.at(typeid(T).name()));
+  unsigned short id = VECS_SETTINGS.component_id<T>();
+  return id < componentArrays.size() ? static_cast<ComponentStorage<T> *>(componentArrays[id].get()) : nullptr;
 }
 
 } // namespace vecs
\ No newline at end of file
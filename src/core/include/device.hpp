@@ -72,6 +72,7 @@ class Device
   
   public:
     Device(const vk::raii::Instance&, const vecs::GUI&, const void * p_next = nullptr);
+    Device(const vk::raii::Instance&, const void * p_next = nullptr);
     Device(const Device&) = delete;
     Device(Device&&) = delete;
 
@@ -1,9 +1,12 @@
 #ifndef vecs_core_engine_hpp
 #define vecs_core_engine_hpp
 
+#include "src/core/include/archetypes.hpp"
 #include "src/core/include/entities.hpp"
 #include "src/core/include/components.hpp"
 #include "src/core/include/systems.hpp"
+#include "src/core/include/snapshots.hpp"
+#include "src/core/include/timestep.hpp"
 #include "src/core/include/device.hpp"
 
 namespace vecs
@@ -29,8 +32,12 @@ class Engine
 
   protected:
     virtual bool close_condition();
+    virtual void step();
+    virtual void render();
     
     bool should_close() const;
+    unsigned long step_count() const;
+    double simulation_time() const;
     
     void initialize(void * p_next = nullptr);
     void poll_gui();
@@ -44,7 +51,10 @@ class Engine
 
     std::unique_ptr<EntityManager> entity_manager = nullptr;
     std::shared_ptr<ComponentManager> component_manager = nullptr;
+    std::shared_ptr<ArchetypeManager> archetype_manager = nullptr;
     std::unique_ptr<SystemManager> system_manager = nullptr;
+    std::unique_ptr<Checkpoint> checkpoint = nullptr;
+    std::unique_ptr<Timestep> timestep = nullptr;
 };
 
 } // namespace vecs
@@ -1,20 +1,30 @@
 #ifndef vecs_core_entities_hpp
 #define vecs_core_entities_hpp
 
+#include "src/core/include/entity.hpp"
+#include "src/core/include/queries.hpp"
 #include "src/core/include/settings.hpp"
 #include "src/core/include/signature.hpp"
 
-#include <map>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <memory_resource>
 #include <set>
-#include <stack>
+#include <vector>
 
 namespace vecs
 {
 
 class EntityManager
 {
+  friend class Checkpoint;
+  friend class Snapshot;
+  friend class SystemManager;
+
   public:
-    EntityManager();
+    EntityManager(std::pmr::memory_resource * resource = std::pmr::get_default_resource());
     EntityManager(const EntityManager&) = delete;
     EntityManager(EntityManager&&) = delete;
 
@@ -24,28 +34,55 @@ class EntityManager
     EntityManager& operator = (EntityManager&&) = delete;
 
     unsigned long count() const;
-    bool valid(unsigned long) const;
+    bool valid(Entity) const;
     
-    void new_entity();
-    void remove_entity(unsigned long);
+    Entity new_entity();
+    void remove_entity(Entity);
 
     template <typename... Tps>
-    std::set<unsigned long> retrieve(bool extactMatch = false) const;
+    std::vector<Entity> create_entities(unsigned long);
+
+    std::vector<Entity> create_entities(unsigned long, const Signature&);
 
     template <typename... Tps>
-    void add_components(unsigned long);
+    std::set<Entity> retrieve(bool extactMatch = false) const;
 
     template <typename... Tps>
-    void remove_components(unsigned long);
+    std::pmr::set<Entity> retrieve(std::pmr::memory_resource *, bool exactMatch = false) const;
 
-  protected:
-    void sort(unsigned long);
+    template <typename... Tps>
+    View view(bool exactMatch = false) const;
+
+    View view(const Signature&, bool exactMatch = false) const;
+
+    template <typename... Tps>
+    void add_components(Entity);
+
+    template <typename... Tps>
+    void remove_components(Entity);
+
+    template <typename... Tps>
+    std::shared_ptr<Query> register_query(bool exactMatch = false);
+
+    std::shared_ptr<Query> register_query(const Signature&, bool exactMatch = false);
+    void unregister_query(const std::shared_ptr<Query>&);
   
   protected:
-    std::vector<Signature> signatures;
-    std::map<unsigned long, unsigned long> indexMap;
-    std::map<unsigned long, unsigned long> idMap;
-    std::stack<unsigned long> nextID;
+    void refresh(Entity);
+
+  protected:
+    static constexpr unsigned long invalid = std::numeric_limits<unsigned long>::max();
+
+    std::pmr::vector<Signature> signatures;
+    std::pmr::vector<Entity> entities;
+    std::pmr::vector<unsigned long> indices;
+    std::pmr::vector<std::uint32_t> generations;
+    std::pmr::vector<EntityIndex> freeIndices;
+    std::pmr::vector<std::shared_ptr<Query>> queries;
+    std::uint64_t revision = 0;
+
+    static std::atomic<std::uint64_t> next_id;
+    std::uint64_t id = ++next_id;
 };
 
 } // namespace vecs
@@ -2,38 +2,86 @@ namespace vecs
 {
 
 template <typename... Tps>
-std::set<unsigned long> EntityManager::retrieve(bool exactMatch) const
+std::set<Entity> EntityManager::retrieve(bool exactMatch) const
 {
   Signature signature;
   signature.set<Tps...>();
 
-  std::set<unsigned long> entities;
+  std::set<Entity> matches;
   
   unsigned long index = 0;
   for (const auto& s : signatures)
   {
-    if (exactMatch ? s == signature : (s & signature) == signature)
-      entities.emplace(idMap.at(index));
+    if (exactMatch ? s == signature : s.contains(signature))
+      matches.emplace(entities[index]);
     ++index;
   }
 
-  return entities;
+  return matches;
 }
 
 template <typename... Tps>
-void EntityManager::add_components(unsigned long e_id)
+std::pmr::set<Entity> EntityManager::retrieve(std::pmr::memory_resource * resource, bool exactMatch) const
 {
-  if (!valid(e_id)) return;
+  Signature signature;
+  signature.set<Tps...>();
+
+  std::pmr::set<Entity> matches(resource);
+
+  unsigned long index = 0;
+  for (const auto& s : signatures)
+  {
+    if (exactMatch ? s == signature : s.contains(signature))
+      matches.emplace(entities[index]);
+    ++index;
+  }
 
-  signatures[indexMap.at(e_id)].set<Tps...>();
+  return matches;
 }
 
 template <typename... Tps>
-void EntityManager::remove_components(unsigned long e_id)
+View EntityManager::view(bool exactMatch) const
 {
-  if (!valid(e_id)) return;
+  Signature signature;
+  signature.set<Tps...>();
+
+  return view(signature, exactMatch);
+}
+
+template <typename... Tps>
+std::vector<Entity> EntityManager::create_entities(unsigned long count)
+{
+  Signature signature;
+  signature.set<Tps...>();
+
+  return create_entities(count, signature);
+}
+
+template <typename... Tps>
+void EntityManager::add_components(Entity entity)
+{
+  if (!valid(entity)) return;
+
+  signatures[indices[entity.index()]].set<Tps...>();
+  refresh(entity);
+}
+
+template <typename... Tps>
+void EntityManager::remove_components(Entity entity)
+{
+  if (!valid(entity)) return;
+
+  signatures[indices[entity.index()]].unset<Tps...>();
+  refresh(entity);
+}
+
+template <typename... Tps>
+std::shared_ptr<Query> EntityManager::register_query(bool exactMatch)
+{
+  Signature signature;
+  signature.set<Tps...>();
 
-  signatures[indexMap.at(e_id)].unset<Tps...>();
+  return register_query(signature, exactMatch);
 }
 
 } // namespace vecs
\ No newline at end of file
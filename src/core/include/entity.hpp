@@ -0,0 +1,53 @@
+#ifndef vecs_core_entity_hpp
+#define vecs_core_entity_hpp
+
+#include <compare>
+#include <cstdint>
+#include <limits>
+
+namespace vecs
+{
+
+#ifdef VECS_64BIT_ENTITIES
+using EntityIndex = std::uint64_t;
+#else
+using EntityIndex = std::uint32_t;
+#endif // VECS_64BIT_ENTITIES
+
+class Entity
+{
+  public:
+    Entity() = default;
+    explicit Entity(EntityIndex, std::uint32_t generation = 0);
+    Entity(const Entity&) = default;
+    Entity(Entity&&) = default;
+
+    ~Entity() = default;
+
+    Entity& operator = (const Entity&) = default;
+    Entity& operator = (Entity&&) = default;
+    bool operator == (const Entity&) const = default;
+    std::strong_ordering operator <=> (const Entity&) const = default;
+
+    EntityIndex index() const;
+    std::uint32_t generation() const;
+    bool null() const;
+
+  private:
+    EntityIndex e_index = std::numeric_limits<EntityIndex>::max();
+    std::uint32_t e_generation = 0;
+};
+
+inline EntityIndex Entity::index() const
+{
+  return e_index;
+}
+
+inline std::uint32_t Entity::generation() const
+{
+  return e_generation;
+}
+
+} // namespace vecs
+
+#endif // vecs_core_entity_hpp
\ No newline at end of file
@@ -4,17 +4,37 @@
 namespace vecs
 {
 
+class Archetype;
+class ArchetypeManager;
+template <typename T> class Column;
+class IColumn;
+class Checkpoint;
+template <typename T> class ChunkedArray;
+template <typename T> class ChunkIterator;
+class ChunkPool;
+class CommandBuffer;
+class CommandQueue;
 class IComponentArray;
 template <typename T> class ComponentArray;
+template <typename T> class SoAComponentArray;
 class ComponentManager;
 class Device;
 class Engine;
+class Entity;
 class EntityManager;
 class GUI;
+class MappedFile;
+class Query;
 class Settings;
 class Signature;
+class Snapshot;
+class SpatialGrid;
+class SpatialIndex;
+class SpatialTree;
 class System;
 class SystemManager;
+class ThreadPool;
+class Timestep;
 
 enum QueueType
 {
@@ -36,6 +56,6 @@ enum FamilyType
   Sparse
 };
 
-}
+} // namespace vecs
 
 #endif // vecs_core_extras_hpp
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef vecs_core_queries_hpp
+#define vecs_core_queries_hpp
+
+#include "src/core/include/entity.hpp"
+#include "src/core/include/signature.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace vecs
+{
+
+class View
+{
+  public:
+    class Iterator
+    {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entity;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entity *;
+        using reference = const Entity&;
+
+      public:
+        Iterator() = default;
+        Iterator(const View *, unsigned long);
+        Iterator(const Iterator&) = default;
+        Iterator(Iterator&&) = default;
+
+        ~Iterator() = default;
+
+        Iterator& operator = (const Iterator&) = default;
+        Iterator& operator = (Iterator&&) = default;
+        reference operator * () const;
+        pointer operator -> () const;
+        Iterator& operator ++ ();
+        Iterator operator ++ (int);
+        bool operator == (const Iterator&) const;
+
+      private:
+        void skip();
+
+      private:
+        const View * view = nullptr;
+        unsigned long index = 0;
+    };
+
+  public:
+    View(std::span<const Entity>);
+    View(std::span<const Entity>, std::span<const Signature>, const Signature&, bool exactMatch = false);
+    View(const View&) = default;
+    View(View&&) = default;
+
+    ~View() = default;
+
+    View& operator = (const View&) = default;
+    View& operator = (View&&) = default;
+
+    Iterator begin() const;
+    Iterator end() const;
+    bool empty() const;
+
+  private:
+    bool matches(unsigned long) const;
+
+  private:
+    std::span<const Entity> v_entities;
+    std::span<const Signature> v_signatures;
+    Signature v_signature;
+    bool v_exact = false;
+};
+
+class Query
+{
+  friend class EntityManager;
+  friend class Snapshot;
+
+  public:
+    Query(const Signature&, bool exactMatch = false);
+    Query(const Query&) = delete;
+    Query(Query&&) = delete;
+
+    ~Query() = default;
+
+    Query& operator = (const Query&) = delete;
+    Query& operator = (Query&&) = delete;
+
+    const Signature& signature() const;
+    bool exact() const;
+    bool matches(const Signature&) const;
+
+    unsigned long size() const;
+    bool contains(Entity) const;
+    std::span<const Entity> entities() const;
+    std::vector<Entity>::const_iterator begin() const;
+    std::vector<Entity>::const_iterator end() const;
+    View view() const;
+
+  private:
+    void insert(Entity);
+    void erase(Entity);
+
+  private:
+    static constexpr unsigned long invalid = std::numeric_limits<unsigned long>::max();
+
+    Signature q_signature;
+    bool q_exact = false;
+
+    std::vector<Entity> q_entities;
+    std::vector<unsigned long> q_indices;
+    unsigned long q_holders = 0;
+};
+
+} // namespace vecs
+
+#endif // vecs_core_queries_hpp
\ No newline at end of file
@@ -9,11 +9,17 @@
 
 #endif // vecs_include_vulkan
 
-#include <map>
+#include "src/core/include/entity.hpp"
+
+#include <limits>
 #include <numeric>
 #include <string>
+#include <thread>
+
+#ifndef VECS_MAX_COMPONENTS
+#define VECS_MAX_COMPONENTS 128
+#endif // VECS_MAX_COMPONENTS
 
-#define VECS_LIMIT      std::numeric_limits<unsigned short>::max()
 #define VECS_SETTINGS   vecs::Settings::instance()
 
 namespace vecs
@@ -41,6 +47,8 @@ class Settings
     float scale_y() const;
     float aspect_ratio() const;
     bool portability_enabled() const;
+    bool headless_enabled() const;
+    bool compute_enabled() const;
     std::vector<const char *> device_extensions() const;
     vk::Format format() const;
     vk::ColorSpaceKHR color_space() const;
@@ -49,11 +57,20 @@ class Settings
     vk::Format depth_format() const;
     unsigned long max_flight_frames() const;
     vk::ClearValue background_color() const;
-    const unsigned short& max_entities() const;
+    const EntityIndex& max_entities() const;
     const unsigned short& max_components() const;
+    unsigned int worker_threads() const;
+    double time_step() const;
+    unsigned long max_steps() const;
+    double max_time() const;
+    unsigned long max_catch_up() const;
+    double frame_rate() const;
+
+    template <typename T>
+    static unsigned short component_id();
 
     template <typename T>
-    unsigned short component_id();
+    static unsigned short system_id();
 
     Settings& update_name(std::string);
     Settings& update_version(unsigned int);
@@ -63,6 +80,8 @@ class Settings
     Settings& update_height(unsigned int);
     Settings& update_scale(float, float);
     Settings& toggle_portability();
+    Settings& toggle_headless();
+    Settings& toggle_compute();
     Settings& add_device_extension(const char *);
     Settings& remove_device_extension(const char *);
     Settings& update_format(vk::Format);
@@ -71,8 +90,14 @@ class Settings
     Settings& update_extent(unsigned int width, unsigned int height);
     Settings& update_max_flight_frames(unsigned long);
     Settings& update_background_color(vk::ClearValue);
-    Settings& update_max_entities(unsigned short);
+    Settings& update_max_entities(EntityIndex);
     Settings& update_max_components(unsigned short);
+    Settings& update_worker_threads(unsigned int);
+    Settings& update_time_step(double);
+    Settings& update_max_steps(unsigned long);
+    Settings& update_max_time(double);
+    Settings& update_max_catch_up(unsigned long);
+    Settings& update_frame_rate(double);
 
     void set_default();
 
@@ -80,12 +105,12 @@ class Settings
     Settings() = default;
     ~Settings() = default;
 
+    static unsigned short nextComponentID();
+    static unsigned short nextSystemID();
+
   private:
     static Settings * p_settings;
 
-    std::map<const char *, unsigned long> s_idMap;
-    unsigned int nextID = 0;
-
     std::string s_name = "VECS Application";
     unsigned int s_version = VK_MAKE_API_VERSION(0, 1, 0, 0);
     bool s_validationEnabled = true;
@@ -97,6 +122,8 @@ class Settings
     float s_scaley = 1.0f;
 
     bool s_portabilityEnabled = false;
+    bool s_headlessEnabled = false;
+    bool s_computeEnabled = true;
 
     std::vector<const char *> s_gpuExtensions{ VK_KHR_SWAPCHAIN_EXTENSION_NAME };
 
@@ -115,8 +142,16 @@ class Settings
       vk::ClearColorValue{std::array<float, 4>{ 0.0025f, 0.01f, 0.005f, 1.0f }}
     };
 
-    unsigned short s_maxEntities = 20000;
+    EntityIndex s_maxEntities = 20000;
     unsigned short s_maxComponents = 100;
+
+    unsigned int s_workerThreads = std::thread::hardware_concurrency();
+
+    double s_timeStep = 1.0 / 60.0;
+    unsigned long s_maxSteps = 0;
+    double s_maxTime = 0.0;
+    unsigned long s_maxCatchUp = 5;
+    double s_frameRate = 0.0;
 };
 
 } // namespace vecs
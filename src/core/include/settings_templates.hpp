@@ -4,12 +4,15 @@ namespace vecs
 template <typename T>
 unsigned short Settings::component_id()
 {
-  const char * typeName = typeid(T).name();
-  
-  if (s_idMap.find(typeName) == s_idMap.end() && nextID != s_maxComponents)
-    s_idMap.emplace(std::make_pair(typeName, nextID++));
+  static const unsigned short id = nextComponentID();
+  return id;
+}
 
-  return s_idMap.at(typeName);
+template <typename T>
+unsigned short Settings::system_id()
+{
+  static const unsigned short id = nextSystemID();
+  return id;
 }
 
 } // namespace vecs
\ No newline at end of file
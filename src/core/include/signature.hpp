@@ -3,8 +3,9 @@
 
 #include "src/core/include/settings.hpp"
 
-#include <bitset>
-#include <numeric>
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <set>
 
 namespace vecs
@@ -13,6 +14,11 @@ namespace vecs
 class Signature
 {  
   public:
+    struct Hash
+    {
+      std::size_t operator () (const Signature&) const;
+    };
+
     Signature() = default;
     Signature(const Signature&) = default;
     Signature(Signature&&) = default;
@@ -22,8 +28,11 @@ class Signature
     Signature& operator = (const Signature&) = default;
     Signature& operator = (Signature&&) = default;
     Signature operator & (const Signature&) const;
+    Signature operator | (const Signature&) const;
     bool operator == (const Signature&) const;
 
+    bool contains(const Signature&) const;
+    bool intersects(const Signature&) const;
     void reset();
 
     template <typename... Tps>
@@ -40,7 +49,10 @@ class Signature
     void remove();
 
   protected:
-    std::bitset<VECS_LIMIT> bits;
+    static constexpr unsigned long word_bits = 64;
+    static constexpr unsigned long word_count = (VECS_MAX_COMPONENTS + word_bits - 1) / word_bits;
+
+    std::array<std::uint64_t, word_count> bits{};
 };
 
 } // namespace vecs
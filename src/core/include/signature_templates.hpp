@@ -16,13 +16,15 @@ void Signature::unset()
 template <typename T>
 void Signature::add()
 {
-  bits.set(VECS_SETTINGS.component_id<T>());
+  unsigned short id = VECS_SETTINGS.component_id<T>();
+  bits[id / word_bits] |= std::uint64_t{1} << (id % word_bits);
 }
 
 template <typename T>
 void Signature::remove()
 {
-  bits.set(VECS_SETTINGS.component_id<T>(), false);
+  unsigned short id = VECS_SETTINGS.component_id<T>();
+  bits[id / word_bits] &= ~(std::uint64_t{1} << (id % word_bits));
 }
 
 } // namespace vecs
\ No newline at end of file
@@ -0,0 +1,239 @@
+#ifndef vecs_core_snapshots_hpp
+#define vecs_core_snapshots_hpp
+
+#include "src/core/include/components.hpp"
+#include "src/core/include/entities.hpp"
+#include "src/core/include/entity.hpp"
+#include "src/core/include/signature.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace vecs
+{
+
+class MappedFile
+{
+  public:
+    MappedFile(const std::string&);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+
+    ~MappedFile();
+
+    MappedFile& operator = (const MappedFile&) = delete;
+    MappedFile& operator = (MappedFile&&) = delete;
+
+    std::span<const std::byte> bytes() const;
+
+  private:
+    void * p_data = nullptr;
+    std::size_t f_size = 0;
+};
+
+class Snapshot
+{
+  friend class Checkpoint;
+
+  public:
+    static constexpr std::uint32_t version = 1;
+    static constexpr std::size_t alignment = 64;
+
+    Snapshot(std::string);
+    Snapshot(const Snapshot&) = default;
+    Snapshot(Snapshot&&) = default;
+
+    ~Snapshot() = default;
+
+    Snapshot& operator = (const Snapshot&) = default;
+    Snapshot& operator = (Snapshot&&) = default;
+
+    const std::string& path() const;
+
+    template <typename... Tps>
+    void save(const EntityManager&, const ComponentManager&) const;
+
+    template <typename... Tps>
+    void load(EntityManager&, ComponentManager&) const;
+
+  private:
+    struct Header
+    {
+      std::array<char, 4> magic{ 'V', 'E', 'C', 'S' };
+      std::uint32_t version = Snapshot::version;
+      std::uint32_t indexSize = sizeof(EntityIndex);
+      std::uint32_t components = 0;
+      std::uint64_t indices = 0;
+      std::uint64_t entities = 0;
+      std::uint64_t free = 0;
+    };
+
+    struct Block
+    {
+      std::uint64_t size = 0;
+      std::uint64_t alignment = 0;
+      std::uint64_t count = 0;
+    };
+
+    static void pad(std::ostream&);
+    static void check(const Header&, std::uint32_t);
+    static std::vector<std::uint64_t> mask(const EntityManager&, std::span<const Signature>);
+    static std::vector<Signature> unmask(std::span<const std::uint64_t>, std::span<const Signature>);
+    static void restore(EntityManager&, ComponentManager&, std::span<const std::uint32_t>, std::span<const EntityIndex>, std::span<const Entity>, std::vector<Signature>);
+
+    template <typename V>
+    static void write(std::ostream&, std::span<const V>);
+
+    template <typename V>
+    static std::span<const V> read(std::span<const std::byte>, unsigned long&, unsigned long);
+
+    template <typename T>
+    static Signature single();
+
+    template <typename T>
+    static void saveComponent(std::ostream&, const ComponentManager&);
+
+    template <typename T>
+    static void skipComponent(std::span<const std::byte>, unsigned long&);
+
+    template <typename T>
+    static void loadComponent(std::span<const std::byte>, unsigned long&, ComponentManager&);
+
+  private:
+    std::string file;
+};
+
+class Checkpoint
+{
+  public:
+    static constexpr std::uint32_t version = 2;
+
+    Checkpoint(std::string, unsigned long interval = 0);
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint(Checkpoint&&) = delete;
+
+    ~Checkpoint();
+
+    Checkpoint& operator = (const Checkpoint&) = delete;
+    Checkpoint& operator = (Checkpoint&&) = delete;
+
+    const std::string& path() const;
+    unsigned long records() const;
+
+    template <typename... Tps>
+    void track();
+
+    void update(const EntityManager&, ComponentManager&);
+    void write(const EntityManager&, ComponentManager&);
+    void wait();
+    void restore(EntityManager&, ComponentManager&);
+
+  private:
+    struct Record
+    {
+      std::array<char, 4> magic{ 'V', 'C', 'K', 'P' };
+      std::uint32_t version = Checkpoint::version;
+      std::uint32_t indexSize = sizeof(EntityIndex);
+      std::uint32_t components = 0;
+      std::uint64_t bytes = 0;
+      std::uint64_t tables = 0;
+      std::uint64_t indices = 0;
+      std::uint64_t entities = 0;
+      std::uint64_t free = 0;
+    };
+
+    struct Block
+    {
+      std::uint64_t size = 0;
+      std::uint64_t alignment = 0;
+      std::uint64_t count = 0;
+      std::uint64_t elements = 0;
+      std::uint64_t chunks = 0;
+      std::uint64_t columns = 1;
+    };
+
+    struct Capture
+    {
+      std::shared_ptr<IComponentArray> array = nullptr;
+      std::shared_ptr<SparseArray::Pin> pin = nullptr;
+      std::vector<std::byte> head;
+      std::vector<std::span<const std::byte>> views;
+      std::vector<std::vector<std::byte>> copies;
+      bool preserved = false;
+    };
+
+    struct Job
+    {
+      std::ios::openmode mode;
+      std::vector<std::byte> head;
+      std::vector<Capture> captures;
+    };
+
+    struct Tracked
+    {
+      Signature signature;
+      std::uint64_t size = 0;
+      std::uint64_t alignment = 0;
+      std::uint64_t columns = 1;
+      std::function<void(ComponentManager&, std::uint32_t, Capture&)> capture;
+      std::function<void(std::span<const std::byte>, std::span<const unsigned long>, ComponentManager&)> replay;
+    };
+
+    static void skip(std::span<const std::byte>, unsigned long&, const Tracked&);
+    static void preserve(Capture&);
+    static void release(std::span<Capture>);
+
+    void work();
+    void flush(Job&);
+
+    template <typename V>
+    static void append(std::vector<std::byte>&, std::span<const V>);
+
+    template <typename T>
+    void add();
+
+    template <typename T>
+    static void capture(ComponentManager&, std::uint32_t, Capture&);
+
+    template <typename T>
+    static void replay(std::span<const std::byte>, std::span<const unsigned long>, ComponentManager&);
+
+  private:
+    std::string file;
+    unsigned long interval = 0;
+    unsigned long frames = 0;
+    unsigned long written = 0;
+    std::uint32_t boundary = 0;
+    std::uint64_t revision = 0;
+    std::vector<Tracked> tracked;
+    std::thread writer;
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::condition_variable idle;
+    std::deque<std::unique_ptr<Job>> jobs;
+    bool stopping = false;
+    std::exception_ptr error = nullptr;
+};
+
+} // namespace vecs
+
+#include "src/core/include/snapshots_templates.hpp"
+
+#endif // vecs_core_snapshots_hpp
\ No newline at end of file
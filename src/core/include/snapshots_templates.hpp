@@ -0,0 +1,301 @@
+namespace vecs
+{
+
+template <typename... Tps>
+void Snapshot::save(const EntityManager& e_manager, const ComponentManager& c_manager) const
+{
+  static_assert(sizeof...(Tps) <= 64, "snapshots hold at most 64 component types");
+
+  std::ofstream stream(file, std::ios::binary | std::ios::trunc);
+  if (!stream)
+    throw std::runtime_error("error @ Snapshot::save() : unable to open " + file);
+
+  Header header;
+  header.components = sizeof...(Tps);
+  header.indices = e_manager.generations.size();
+  header.entities = e_manager.entities.size();
+  header.free = e_manager.freeIndices.size();
+
+  const std::array<Signature, sizeof...(Tps)> singles{ single<Tps>()... };
+  std::vector<std::uint64_t> masks = mask(e_manager, singles);
+
+  write(stream, std::span<const Header>(&header, 1));
+  write<std::uint32_t>(stream, e_manager.generations);
+  write<EntityIndex>(stream, e_manager.freeIndices);
+  write<Entity>(stream, e_manager.entities);
+  write<std::uint64_t>(stream, masks);
+
+  ( saveComponent<Tps>(stream, c_manager), ... );
+
+  if (!stream)
+    throw std::runtime_error("error @ Snapshot::save() : unable to write " + file);
+}
+
+template <typename... Tps>
+void Snapshot::load(EntityManager& e_manager, ComponentManager& c_manager) const
+{
+  static_assert(sizeof...(Tps) <= 64, "snapshots hold at most 64 component types");
+
+  MappedFile mapped(file);
+  std::span<const std::byte> bytes = mapped.bytes();
+  unsigned long offset = 0;
+
+  const Header& header = read<Header>(bytes, offset, 1).front();
+  check(header, sizeof...(Tps));
+
+  auto generations = read<std::uint32_t>(bytes, offset, header.indices);
+  auto freeIndices = read<EntityIndex>(bytes, offset, header.free);
+  auto entities = read<Entity>(bytes, offset, header.entities);
+  auto masks = read<std::uint64_t>(bytes, offset, header.entities);
+
+  unsigned long components = offset;
+  ( skipComponent<Tps>(bytes, offset), ... );
+
+  const std::array<Signature, sizeof...(Tps)> singles{ single<Tps>()... };
+  restore(e_manager, c_manager, generations, freeIndices, entities, unmask(masks, singles));
+
+  c_manager.register_components<Tps...>();
+  ( loadComponent<Tps>(bytes, components, c_manager), ... );
+}
+
+template <typename V>
+void Snapshot::write(std::ostream& stream, std::span<const V> values)
+{
+  static_assert(std::is_trivially_copyable_v<V>, "snapshot data must be trivially copyable");
+
+  pad(stream);
+  stream.write(reinterpret_cast<const char *>(values.data()), values.size_bytes());
+}
+
+template <typename V>
+std::span<const V> Snapshot::read(std::span<const std::byte> bytes, unsigned long& offset, unsigned long count)
+{
+  offset = (offset + alignment - 1) / alignment * alignment;
+  if (offset > bytes.size() || count > (bytes.size() - offset) / sizeof(V))
+    throw std::runtime_error("error @ Snapshot::load() : snapshot is truncated");
+
+  std::span<const V> values(reinterpret_cast<const V *>(bytes.data() + offset), count);
+  offset += values.size_bytes();
+
+  return values;
+}
+
+template <typename T>
+Signature Snapshot::single()
+{
+  Signature signature;
+  signature.set<T>();
+
+  return signature;
+}
+
+template <typename T>
+void Snapshot::saveComponent(std::ostream& stream, const ComponentManager& c_manager)
+{
+  static_assert(std::is_trivially_copyable_v<T>, "snapshot components must be trivially copyable");
+
+  const auto * components = c_manager.lookup<T>();
+
+  Block block{ sizeof(T), alignof(T), components == nullptr ? 0 : components->size() };
+  write(stream, std::span<const Block>(&block, 1));
+
+  if (block.count == 0) return;
+
+  write(stream, components->entities());
+
+  if constexpr (SoALayout<T>::enabled)
+  {
+    std::vector<T> values;
+    values.reserve(block.count);
+    for (Entity e_id : components->entities())
+      values.emplace_back(components->at(e_id));
+
+    write<T>(stream, values);
+  }
+  else
+  {
+    const auto& chunks = std::as_const(*components);
+
+    pad(stream);
+    for (unsigned long i = 0; i < chunks.chunk_count(); ++i)
+    {
+      std::span<const T> chunk = chunks.chunk(i);
+      stream.write(reinterpret_cast<const char *>(chunk.data()), chunk.size_bytes());
+    }
+  }
+}
+
+template <typename T>
+void Snapshot::skipComponent(std::span<const std::byte> bytes, unsigned long& offset)
+{
+  const Block& block = read<Block>(bytes, offset, 1).front();
+  if (block.size != sizeof(T) || block.alignment != alignof(T))
+    throw std::runtime_error("error @ Snapshot::load() : layout of " + std::string(typeid(T).name()) + " does not match");
+
+  if (block.count == 0) return;
+
+  read<Entity>(bytes, offset, block.count);
+  read<T>(bytes, offset, block.count);
+}
+
+template <typename T>
+void Snapshot::loadComponent(std::span<const std::byte> bytes, unsigned long& offset, ComponentManager& c_manager)
+{
+  const Block& block = read<Block>(bytes, offset, 1).front();
+  if (block.count == 0) return;
+
+  auto e_ids = read<Entity>(bytes, offset, block.count);
+  auto values = read<T>(bytes, offset, block.count);
+
+  c_manager.update_data<T>(e_ids, values);
+}
+
+template <typename... Tps>
+void Checkpoint::track()
+{
+  ( add<Tps>(), ... );
+}
+
+template <typename V>
+void Checkpoint::append(std::vector<std::byte>& buffer, std::span<const V> values)
+{
+  static_assert(std::is_trivially_copyable_v<V>, "checkpoint data must be trivially copyable");
+
+  unsigned long offset = (buffer.size() + Snapshot::alignment - 1) / Snapshot::alignment * Snapshot::alignment;
+  buffer.resize(offset + values.size_bytes());
+  if (!values.empty())
+    std::memcpy(buffer.data() + offset, values.data(), values.size_bytes());
+}
+
+template <typename T>
+void Checkpoint::add()
+{
+  static_assert(std::is_trivially_copyable_v<T>, "checkpoint components must be trivially copyable");
+
+  if (tracked.size() == 64)
+    throw std::runtime_error("error @ Checkpoint::track() : checkpoints hold at most 64 component types");
+
+  std::uint64_t columns = 1;
+  if constexpr (SoALayout<T>::enabled)
+    columns = SoALayout<T>::fields;
+
+  tracked.emplace_back(Tracked{ Snapshot::single<T>(), sizeof(T), alignof(T), columns, &Checkpoint::capture<T>, &Checkpoint::replay<T> });
+}
+
+template <typename T>
+void Checkpoint::capture(ComponentManager& c_manager, std::uint32_t since, Capture& capture)
+{
+  auto * components = c_manager.lookup<T>();
+
+  Block block{ sizeof(T), alignof(T), components == nullptr ? 0 : components->size(), ChunkedArray<T>::chunk_elements };
+  if constexpr (SoALayout<T>::enabled)
+    block.columns = SoALayout<T>::fields;
+
+  std::vector<std::uint64_t> chunks;
+  for (unsigned long i = 0; i < (block.count + block.elements - 1) / block.elements; ++i)
+  {
+    if (components->chunk_tick(i) >= since)
+      chunks.emplace_back(i);
+  }
+
+  block.chunks = chunks.size();
+  append(capture.head, std::span<const Block>(&block, 1));
+  append<std::uint64_t>(capture.head, chunks);
+
+  if (chunks.empty()) return;
+
+  capture.array = c_manager.array<T>();
+  capture.pin = components->pin();
+
+  const auto& storage = std::as_const(*components);
+  for (std::uint64_t chunk : chunks)
+  {
+    unsigned long first = chunk * block.elements;
+    unsigned long count = std::min(block.elements, block.count - first);
+    capture.views.emplace_back(std::as_bytes(storage.entities().subspan(first, count)));
+
+    if constexpr (SoALayout<T>::enabled)
+    {
+      for (unsigned long field = 0; field < block.columns; ++field)
+        capture.views.emplace_back(std::as_bytes(storage.column(field).subspan(first, count)));
+    }
+    else
+    {
+      capture.views.emplace_back(std::as_bytes(storage.chunk(chunk)));
+    }
+  }
+}
+
+template <typename T>
+void Checkpoint::replay(std::span<const std::byte> bytes, std::span<const unsigned long> offsets, ComponentManager& c_manager)
+{
+  std::vector<std::pair<unsigned long, unsigned long>> latest;
+  unsigned long count = 0;
+  unsigned long elements = 1;
+
+  for (unsigned long offset : offsets)
+  {
+    const Block& block = Snapshot::read<Block>(bytes, offset, 1).front();
+    auto chunks = Snapshot::read<std::uint64_t>(bytes, offset, block.chunks);
+
+    count = block.count;
+    elements = block.elements;
+    latest.resize((count + elements - 1) / elements);
+
+    for (std::uint64_t chunk : chunks)
+    {
+      unsigned long size = std::min(elements, count - chunk * elements);
+      latest[chunk] = { offset, size };
+
+      Snapshot::read<Entity>(bytes, offset, size);
+      for (unsigned long column = 0; column < block.columns; ++column)
+        Snapshot::read<std::byte>(bytes, offset, size * block.size / block.columns);
+    }
+  }
+
+  std::vector<Entity> e_ids;
+  std::vector<T> values;
+  e_ids.reserve(count);
+  values.reserve(count);
+
+  for (unsigned long chunk = 0; chunk < latest.size(); ++chunk)
+  {
+    auto [offset, size] = latest[chunk];
+    unsigned long used = std::min(elements, count - chunk * elements);
+    if (size < used)
+      throw std::runtime_error("error @ Checkpoint::restore() : checkpoint is corrupt");
+
+    auto chunk_ids = Snapshot::read<Entity>(bytes, offset, size);
+    e_ids.insert(e_ids.end(), chunk_ids.begin(), chunk_ids.begin() + used);
+
+    if constexpr (SoALayout<T>::enabled)
+    {
+      using value_type = typename SoALayout<T>::value_type;
+      constexpr unsigned long fields = SoALayout<T>::fields;
+
+      std::array<std::span<const value_type>, fields> columns;
+      for (auto& column : columns)
+        column = Snapshot::read<value_type>(bytes, offset, size);
+
+      for (unsigned long i = 0; i < used; ++i)
+      {
+        std::array<value_type, fields> element;
+        for (unsigned long field = 0; field < fields; ++field)
+          element[field] = columns[field][i];
+
+        values.emplace_back(std::bit_cast<T>(element));
+      }
+    }
+    else
+    {
+      auto chunk_values = Snapshot::read<T>(bytes, offset, size);
+      for (unsigned long i = 0; i < used; ++i)
+        values.emplace_back(chunk_values[i]);
+    }
+  }
+
+  c_manager.register_components<T>();
+  c_manager.update_data<T>(e_ids, values);
+}
+
+} // namespace vecs
\ No newline at end of file
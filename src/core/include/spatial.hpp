@@ -0,0 +1,145 @@
+#ifndef vecs_core_spatial_hpp
+#define vecs_core_spatial_hpp
+
+#include "src/core/include/components.hpp"
+#include "src/core/include/entity.hpp"
+#include "src/core/include/threads.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace vecs
+{
+
+using Point = std::array<float, 3>;
+
+struct Coordinates
+{
+  template <typename T>
+  Point operator () (const T&) const;
+};
+
+class SpatialIndex
+{
+  public:
+    SpatialIndex() = default;
+    SpatialIndex(const SpatialIndex&) = default;
+    SpatialIndex(SpatialIndex&&) = default;
+
+    virtual ~SpatialIndex() = default;
+
+    SpatialIndex& operator = (const SpatialIndex&) = default;
+    SpatialIndex& operator = (SpatialIndex&&) = default;
+
+    template <typename T, typename F = Coordinates>
+    void rebuild(const ComponentManager&, F project = {}, ThreadPool * pool = nullptr);
+
+    void rebuild(std::span<const Entity>, std::span<const Point>, ThreadPool * pool = nullptr);
+
+    unsigned long size() const;
+    std::span<const Entity> entities() const;
+    std::span<const Point> points() const;
+
+    std::vector<Entity> radius(const Point&, float) const;
+    std::vector<Entity> nearest(const Point&, unsigned long) const;
+
+    template <typename F>
+    void each(const Point&, float, F&&) const;
+
+  protected:
+    static float squared(const Point&, const Point&);
+    static void run(ThreadPool *, unsigned long, const std::function<void(unsigned long)>&);
+
+    void bound();
+
+    virtual void build(ThreadPool *) = 0;
+    virtual void visit(const Point&, float, const std::function<void(unsigned long)>&) const = 0;
+    virtual float spacing() const = 0;
+
+  protected:
+    static constexpr unsigned long batch_size = 4096;
+
+    std::vector<Entity> s_entities;
+    std::vector<Point> s_points;
+    Point s_min{};
+    Point s_max{};
+};
+
+class SpatialGrid : public SpatialIndex
+{
+  public:
+    SpatialGrid(float);
+    SpatialGrid(const SpatialGrid&) = default;
+    SpatialGrid(SpatialGrid&&) = default;
+
+    ~SpatialGrid() = default;
+
+    SpatialGrid& operator = (const SpatialGrid&) = default;
+    SpatialGrid& operator = (SpatialGrid&&) = default;
+
+    float cell_size() const;
+    std::span<const Entity> cell(const Point&) const;
+
+  protected:
+    void build(ThreadPool *) override;
+    void visit(const Point&, float, const std::function<void(unsigned long)>&) const override;
+    float spacing() const override;
+
+  private:
+    std::array<std::int64_t, 3> coordinates(const Point&) const;
+    unsigned long bucket(const std::array<std::int64_t, 3>&) const;
+
+  private:
+    static constexpr double max_cell = 4503599627370496.0;
+
+    float g_cellSize = 1.0f;
+    std::vector<unsigned long> g_starts;
+};
+
+class SpatialTree : public SpatialIndex
+{
+  public:
+    SpatialTree(unsigned long leafSize = 8);
+    SpatialTree(const SpatialTree&) = default;
+    SpatialTree(SpatialTree&&) = default;
+
+    ~SpatialTree() = default;
+
+    SpatialTree& operator = (const SpatialTree&) = default;
+    SpatialTree& operator = (SpatialTree&&) = default;
+
+    unsigned long node_count() const;
+
+  protected:
+    void build(ThreadPool *) override;
+    void visit(const Point&, float, const std::function<void(unsigned long)>&) const override;
+    float spacing() const override;
+
+  private:
+    struct Node
+    {
+      Point min{};
+      Point max{};
+      unsigned long first = 0;
+      unsigned long count = 0;
+      unsigned long right = 0;
+    };
+
+    unsigned long nodes(unsigned long) const;
+    void split(ThreadPool *, std::vector<unsigned long>&, unsigned long, unsigned long, unsigned long);
+
+  private:
+    unsigned long t_leafSize = 8;
+    std::vector<Node> t_nodes;
+};
+
+} // namespace vecs
+
+#include "src/core/include/spatial_templates.hpp"
+
+#endif // vecs_core_spatial_hpp
\ No newline at end of file
@@ -0,0 +1,51 @@
+namespace vecs
+{
+
+template <typename T>
+Point Coordinates::operator () (const T& position) const
+{
+  return Point{ static_cast<float>(position.x), static_cast<float>(position.y), static_cast<float>(position.z) };
+}
+
+template <typename T, typename F>
+void SpatialIndex::rebuild(const ComponentManager& c_manager, F project, ThreadPool * pool)
+{
+  const auto * components = c_manager.storage<T>();
+  if (components == nullptr)
+  {
+    rebuild(std::span<const Entity>(), std::span<const Point>(), pool);
+    return;
+  }
+
+  s_entities.assign(components->entities().begin(), components->entities().end());
+  s_points.resize(s_entities.size());
+
+  if constexpr (SoALayout<T>::enabled)
+  {
+    run(pool, (s_entities.size() + batch_size - 1) / batch_size, [&](unsigned long batch){
+      unsigned long last = std::min(s_entities.size(), (batch + 1) * batch_size);
+      for (unsigned long i = batch * batch_size; i < last; ++i)
+        s_points[i] = project(components->at(s_entities[i]));
+    });
+  }
+  else
+  {
+    run(pool, components->chunk_count(), [&](unsigned long chunk){
+      std::span<const T> values = components->chunk(chunk);
+      unsigned long first = chunk << ChunkedArray<T>::shift;
+      for (unsigned long i = 0; i < values.size(); ++i)
+        s_points[first + i] = project(values[i]);
+    });
+  }
+
+  bound();
+  build(pool);
+}
+
+template <typename F>
+void SpatialIndex::each(const Point& center, float radius, F&& f) const
+{
+  visit(center, radius, [&](unsigned long i){ f(s_entities[i]); });
+}
+
+} // namespace vecs
\ No newline at end of file
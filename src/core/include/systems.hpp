@@ -1,18 +1,32 @@
 #ifndef vecs_core_systems_hpp
 #define vecs_core_systems_hpp
 
+#include "src/core/include/archetypes.hpp"
+#include "src/core/include/commands.hpp"
 #include "src/core/include/components.hpp"
+#include "src/core/include/entities.hpp"
+#include "src/core/include/entity.hpp"
+#include "src/core/include/queries.hpp"
 #include "src/core/include/signature.hpp"
+#include "src/core/include/threads.hpp"
 
-#include <map>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <memory>
 #include <optional>
+#include <set>
+#include <span>
+#include <type_traits>
+#include <vector>
 
 namespace vecs
 {
 
 class System
 {
+  friend class SystemManager;
+
   public:
     System() = default;
     System(const System&) = default;
@@ -23,18 +37,52 @@ class System
     System& operator = (const System&) = default;
     System& operator = (System&&) = default;
 
-    virtual void update(const std::shared_ptr<ComponentManager>&, std::set<unsigned long>) = 0;
+    virtual void update(const std::shared_ptr<ComponentManager>&, const View&) = 0;
+    void update(const std::shared_ptr<ComponentManager>&, const std::set<Entity>&);
+    virtual void update_archetypes(const std::shared_ptr<ArchetypeManager>&, std::span<const std::shared_ptr<Archetype>>);
     
     const Signature& signature() const;
+    const Signature& reads() const;
+    const Signature& writes() const;
+    bool conflicts(const System&) const;
+    std::uint32_t last_tick() const;
+    ThreadPool * thread_pool() const;
     
     template <typename... Tps>
     void addComponents();
 
     template <typename... Tps>
     void removeComponents();
+
+    template <typename... Tps>
+    void readComponents();
+
+    template <typename... Tps>
+    void writeComponents();
+
+    CommandBuffer& commands() const;
+
+    template <typename R, typename F>
+    void parallel_each(const R&, F&&, unsigned long chunkSize = 256) const;
+
+    template <typename R, typename T, typename F, typename Op>
+    T parallel_reduce(const R&, T, F&&, Op&&, unsigned long chunkSize = 256) const;
+
+  private:
+    bool exclusive() const;
+
+    template <typename R>
+    static std::span<const Entity> gather(const R&, std::vector<Entity>&);
+
+    void run(unsigned long, const std::function<void(unsigned long)>&) const;
   
   private:
     Signature sys_signature;
+    Signature sys_reads;
+    Signature sys_writes;
+    std::uint32_t sys_tick = 0;
+    std::shared_ptr<ThreadPool> sys_pool = nullptr;
+    std::shared_ptr<CommandQueue> sys_commands = std::make_shared<CommandQueue>();
 };
 
 class SystemManager
@@ -64,6 +112,19 @@ class SystemManager
     template <typename T, typename... Tps>
     void remove_components();
 
+    template <typename T, typename... Tps>
+    void read_components();
+
+    template <typename T, typename... Tps>
+    void write_components();
+
+    void update(const std::shared_ptr<ComponentManager>&, EntityManager&);
+    void update(const std::shared_ptr<ArchetypeManager>&);
+
+  protected:
+    void schedule();
+    void track(EntityManager&);
+
   protected:
     template <typename T>
     bool registered() const;
@@ -75,7 +136,14 @@ class SystemManager
     void remove();
 
   protected:
-    std::map<const char *, std::shared_ptr<System>> systemMap;
+    std::vector<std::shared_ptr<System>> systems;
+    std::vector<std::shared_ptr<Query>> queries;
+    std::vector<unsigned short> order;
+    std::vector<std::vector<unsigned short>> stages;
+    std::shared_ptr<ThreadPool> pool = nullptr;
+    std::shared_ptr<CommandQueue> commands = std::make_shared<CommandQueue>();
+    std::uint64_t tracked = 0;
+    bool modified = false;
 };
 
 } // namespace vecs
@@ -13,13 +13,97 @@ void System::removeComponents()
   sys_signature.unset<Tps...>();
 }
 
+template <typename... Tps>
+void System::readComponents()
+{
+  sys_reads.set<Tps...>();
+}
+
+template <typename... Tps>
+void System::writeComponents()
+{
+  sys_writes.set<Tps...>();
+}
+
+template <typename R, typename F>
+void System::parallel_each(const R& e_ids, F&& f, unsigned long chunkSize) const
+{
+  std::vector<Entity> buffer;
+  std::span<const Entity> entities = gather(e_ids, buffer);
+
+  chunkSize = std::max(chunkSize, 1ul);
+  unsigned long count = (entities.size() + chunkSize - 1) / chunkSize;
+
+  run(count, [&](unsigned long chunk){
+    auto range = entities.subspan(chunk * chunkSize, std::min(chunkSize, entities.size() - chunk * chunkSize));
+
+    if constexpr (std::is_invocable_v<F&, std::span<const Entity>, unsigned long>)
+      f(range, chunk);
+    else
+    {
+      for (const auto& e_id : range)
+        f(e_id);
+    }
+  });
+}
+
+template <typename R, typename T, typename F, typename Op>
+T System::parallel_reduce(const R& e_ids, T init, F&& f, Op&& op, unsigned long chunkSize) const
+{
+  std::vector<Entity> buffer;
+  std::span<const Entity> entities = gather(e_ids, buffer);
+
+  chunkSize = std::max(chunkSize, 1ul);
+  unsigned long count = (entities.size() + chunkSize - 1) / chunkSize;
+  std::vector<std::optional<T>> partials(count);
+
+  run(count, [&](unsigned long chunk){
+    auto range = entities.subspan(chunk * chunkSize, std::min(chunkSize, entities.size() - chunk * chunkSize));
+
+    std::optional<T>& partial = partials[chunk];
+    for (const auto& e_id : range)
+    {
+      if (partial.has_value())
+        partial = op(*partial, f(e_id));
+      else
+        partial.emplace(f(e_id));
+    }
+  });
+
+  for (const auto& partial : partials)
+  {
+    if (partial.has_value())
+      init = op(init, *partial);
+  }
+
+  return init;
+}
+
+template <typename R>
+std::span<const Entity> System::gather(const R& e_ids, std::vector<Entity>& buffer)
+{
+  if constexpr (std::is_same_v<R, Query>)
+    return e_ids.entities();
+  else if constexpr (std::is_same_v<R, std::shared_ptr<Query>>)
+    return e_ids->entities();
+  else if constexpr (std::is_convertible_v<const R&, std::span<const Entity>>)
+    return e_ids;
+  else
+  {
+    for (const auto& e_id : e_ids)
+      buffer.emplace_back(e_id);
+
+    return buffer;
+  }
+}
+
 template <typename T>
 std::optional<std::shared_ptr<T>> SystemManager::system() const
 {
   if (!registered<T>()) return std::nullopt;
 
   return std::optional<std::shared_ptr<T>>(
-    std::static_pointer_cast<T>(systemMap.at(typeid(T).name()))
+    std::static_pointer_cast<T>(systems[VECS_SETTINGS.system_id<T>()])
   );
 }
 
@@ -40,7 +124,8 @@ void SystemManager::add_components()
 {
   if (!registered<T>()) return;
 
-  systemMap.at(typeid(T).name())->addComponents<Tps...>();
+  systems[VECS_SETTINGS.system_id<T>()]->template addComponents<Tps...>();
+  modified = true;
 }
 
 template <typename T, typename... Tps>
@@ -48,13 +133,33 @@ void SystemManager::remove_components()
 {
   if (!registered<T>()) return;
 
-  systemMap.at(typeid(T).name())->removeComponents<Tps...>();
+  systems[VECS_SETTINGS.system_id<T>()]->template removeComponents<Tps...>();
+  modified = true;
+}
+
+template <typename T, typename... Tps>
+void SystemManager::read_components()
+{
+  if (!registered<T>()) return;
+
+  systems[VECS_SETTINGS.system_id<T>()]->template readComponents<Tps...>();
+  modified = true;
+}
+
+template <typename T, typename... Tps>
+void SystemManager::write_components()
+{
+  if (!registered<T>()) return;
+
+  systems[VECS_SETTINGS.system_id<T>()]->template writeComponents<Tps...>();
+  modified = true;
 }
 
 template <typename T>
 bool SystemManager::registered() const
 {
-  return systemMap.find(typeid(T).name()) != systemMap.end();
+  unsigned short id = VECS_SETTINGS.system_id<T>();
+  return id < systems.size() && systems[id] != nullptr;
 }
 
 template <typename T>
@@ -62,15 +167,30 @@ void SystemManager::add()
 {
   if (!std::is_base_of<System, T>::value || registered<T>()) return;
 
-  systemMap.emplace(std::make_pair(typeid(T).name(), std::make_shared<T>()));
-};
+  unsigned short id = VECS_SETTINGS.system_id<T>();
+  if (id >= systems.size())
+    systems.resize(id + 1);
+
+  if (pool == nullptr)
+    pool = std::make_shared<ThreadPool>(VECS_SETTINGS.worker_threads());
+
+  systems[id] = std::make_shared<T>();
+  systems[id]->sys_pool = pool;
+  systems[id]->sys_commands = commands;
+  order.emplace_back(id);
+  modified = true;
+}
 
 template <typename T>
 void SystemManager::remove()
 {
   if (!registered<T>()) return;
 
-  systemMap.erase(typeid(T).name());
+  unsigned short id = VECS_SETTINGS.system_id<T>();
+
+  systems[id].reset();
+  std::erase(order, id);
+  modified = true;
 }
 
 } // namespace vecs
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef vecs_core_threads_hpp
+#define vecs_core_threads_hpp
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vecs
+{
+
+class ThreadPool
+{
+  public:
+    ThreadPool(unsigned int threads = std::thread::hardware_concurrency());
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool(ThreadPool&&) = delete;
+
+    ~ThreadPool();
+
+    ThreadPool& operator = (const ThreadPool&) = delete;
+    ThreadPool& operator = (ThreadPool&&) = delete;
+
+    unsigned int size() const;
+
+    void submit(std::function<void()>);
+    void wait();
+
+    void parallel_for(unsigned long, const std::function<void(unsigned long)>&);
+
+  private:
+    struct Loop
+    {
+      const std::function<void(unsigned long)>& task;
+      std::atomic<unsigned long> remaining;
+      std::mutex mutex;
+      std::exception_ptr failure;
+    };
+
+    struct Task
+    {
+      Loop * loop;
+      std::function<void()> job;
+      unsigned long index;
+    };
+
+    struct Queue
+    {
+      std::mutex mutex;
+      std::deque<Task> tasks;
+    };
+
+    unsigned long current();
+    void wake(unsigned long);
+    bool take(unsigned long, Task&);
+    bool runOne(unsigned long);
+    void runLoop(Loop&, unsigned long);
+    void runJob(std::function<void()>&);
+    void work(unsigned long);
+
+  private:
+    std::vector<std::thread> workers;
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::atomic<unsigned long> nextQueue = 0;
+
+    std::atomic<unsigned long> queued = 0;
+    std::atomic<unsigned long> pending = 0;
+    std::atomic<unsigned long> sleeping = 0;
+    std::atomic<unsigned long> finished = 0;
+
+    std::mutex mutex;
+    std::condition_variable taskReady;
+    std::condition_variable tasksDone;
+
+    bool stopping = false;
+    std::exception_ptr error = nullptr;
+};
+
+} // namespace vecs
+
+#endif // vecs_core_threads_hpp
\ No newline at end of file
@@ -0,0 +1,62 @@
+#ifndef vecs_core_timestep_hpp
+#define vecs_core_timestep_hpp
+
+#include <chrono>
+
+namespace vecs
+{
+
+class Timestep
+{
+  public:
+    struct Stats
+    {
+      unsigned long ticks = 0;
+      unsigned long frames = 0;
+      unsigned long skipped = 0;
+      double last = 0.0;
+      double average = 0.0;
+      double peak = 0.0;
+      double lag = 0.0;
+    };
+
+    Timestep(double, unsigned long maxCatchUp = 5, double frameRate = 0.0);
+    Timestep(const Timestep&) = default;
+    Timestep(Timestep&&) = default;
+
+    ~Timestep() = default;
+
+    Timestep& operator = (const Timestep&) = default;
+    Timestep& operator = (Timestep&&) = default;
+
+    template <typename F>
+    unsigned long advance(double, F&&);
+
+    bool present(double);
+
+    double step() const;
+    unsigned long max_catch_up() const;
+    double frame_rate() const;
+    unsigned long ticks() const;
+    double time() const;
+    double alpha() const;
+    const Stats& stats() const;
+
+  private:
+    void record(double);
+    void settle();
+
+  private:
+    double ts_step = 1.0 / 60.0;
+    unsigned long ts_maxCatchUp = 5;
+    double ts_frameRate = 0.0;
+    double ts_accumulator = 0.0;
+    double ts_frameAccumulator = 0.0;
+    Stats ts_stats;
+};
+
+} // namespace vecs
+
+#include "src/core/include/timestep_templates.hpp"
+
+#endif // vecs_core_timestep_hpp
\ No newline at end of file
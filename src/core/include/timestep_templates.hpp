@@ -0,0 +1,24 @@
+namespace vecs
+{
+
+template <typename F>
+unsigned long Timestep::advance(double seconds, F&& tick)
+{
+  ts_accumulator += seconds > 0.0 ? seconds : 0.0;
+
+  unsigned long count = 0;
+  while (ts_accumulator >= ts_step && count < ts_maxCatchUp)
+  {
+    auto start = std::chrono::steady_clock::now();
+    tick();
+    record(std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+    ts_accumulator -= ts_step;
+    ++count;
+  }
+
+  settle();
+  return count;
+}
+
+} // namespace vecs
\ No newline at end of file
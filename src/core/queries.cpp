@@ -0,0 +1,164 @@
+#include "src/core/include/queries.hpp"
+
+namespace vecs
+{
+
+View::Iterator::Iterator(const View * p_view, unsigned long i)
+: view(p_view), index(i)
+{
+  skip();
+}
+
+View::Iterator::reference View::Iterator::operator * () const
+{
+  return view->v_entities[index];
+}
+
+View::Iterator::pointer View::Iterator::operator -> () const
+{
+  return &view->v_entities[index];
+}
+
+View::Iterator& View::Iterator::operator ++ ()
+{
+  ++index;
+  skip();
+
+  return *this;
+}
+
+View::Iterator View::Iterator::operator ++ (int)
+{
+  Iterator itr = *this;
+  ++(*this);
+
+  return itr;
+}
+
+bool View::Iterator::operator == (const Iterator& rhs) const
+{
+  return view == rhs.view && index == rhs.index;
+}
+
+void View::Iterator::skip()
+{
+  while (index < view->v_entities.size() && !view->matches(index))
+    ++index;
+}
+
+View::View(std::span<const Entity> entities)
+: v_entities(entities)
+{}
+
+View::View(std::span<const Entity> entities, std::span<const Signature> signatures, const Signature& signature, bool exactMatch)
+: v_entities(entities), v_signatures(signatures), v_signature(signature), v_exact(exactMatch)
+{}
+
+View::Iterator View::begin() const
+{
+  return Iterator(this, 0);
+}
+
+View::Iterator View::end() const
+{
+  return Iterator(this, v_entities.size());
+}
+
+bool View::empty() const
+{
+  return begin() == end();
+}
+
+bool View::matches(unsigned long index) const
+{
+  if (v_signatures.empty()) return true;
+
+  return v_exact ? v_signatures[index] == v_signature : v_signatures[index].contains(v_signature);
+}
+
+Query::Query(const Signature& signature, bool exactMatch)
+: q_signature(signature), q_exact(exactMatch)
+{}
+
+const Signature& Query::signature() const
+{
+  return q_signature;
+}
+
+bool Query::exact() const
+{
+  return q_exact;
+}
+
+bool Query::matches(const Signature& signature) const
+{
+  return q_exact ? signature == q_signature : signature.contains(q_signature);
+}
+
+unsigned long Query::size() const
+{
+  return q_entities.size();
+}
+
+bool Query::contains(Entity entity) const
+{
+  if (entity.index() >= q_indices.size() || q_indices[entity.index()] == invalid)
+    return false;
+
+  return q_entities[q_indices[entity.index()]] == entity;
+}
+
+std::span<const Entity> Query::entities() const
+{
+  return q_entities;
+}
+
+std::vector<Entity>::const_iterator Query::begin() const
+{
+  return q_entities.begin();
+}
+
+std::vector<Entity>::const_iterator Query::end() const
+{
+  return q_entities.end();
+}
+
+View Query::view() const
+{
+  return View(q_entities);
+}
+
+void Query::insert(Entity entity)
+{
+  if (entity.index() >= q_indices.size())
+    q_indices.resize(entity.index() + 1, invalid);
+
+  unsigned long& index = q_indices[entity.index()];
+  if (index != invalid)
+  {
+    q_entities[index] = entity;
+    return;
+  }
+
+  index = q_entities.size();
+  q_entities.emplace_back(entity);
+}
+
+void Query::erase(Entity entity)
+{
+  if (entity.index() >= q_indices.size() || q_indices[entity.index()] == invalid) return;
+
+  unsigned long& index = q_indices[entity.index()];
+  unsigned long last = q_entities.size() - 1;
+
+  if (index != last)
+  {
+    q_entities[index] = q_entities[last];
+    q_indices[q_entities[index].index()] = index;
+  }
+
+  q_entities.pop_back();
+  index = invalid;
+}
+
+} // namespace vecs
\ No newline at end of file
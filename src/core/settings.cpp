@@ -1,5 +1,8 @@
 #include "src/core/include/settings.hpp"
 
+#include <algorithm>
+#include <atomic>
+
 namespace vecs
 {
 
@@ -21,6 +24,24 @@ void Settings::destroy()
   p_settings = nullptr;
 }
 
+unsigned short Settings::nextComponentID()
+{
+  static std::atomic<unsigned short> nextID = 0;
+
+  unsigned short id = nextID++;
+  if (id >= instance().max_components())
+    throw std::runtime_error("error @ Settings::component_id() : component limit reached");
+
+  return id;
+}
+
+unsigned short Settings::nextSystemID()
+{
+  static std::atomic<unsigned short> nextID = 0;
+
+  return nextID++;
+}
+
 std::string Settings::name() const
 {
   return s_name;
@@ -71,9 +92,29 @@ bool Settings::portability_enabled() const
   return s_portabilityEnabled;
 }
 
+bool Settings::headless_enabled() const
+{
+  return s_headlessEnabled;
+}
+
+bool Settings::compute_enabled() const
+{
+  return s_computeEnabled;
+}
+
 std::vector<const char *> Settings::device_extensions() const
 {
-  return s_gpuExtensions;
+  if (!s_headlessEnabled)
+    return s_gpuExtensions;
+
+  std::vector<const char *> extensions;
+  for (auto * extension : s_gpuExtensions)
+  {
+    if (std::string(extension) != VK_KHR_SWAPCHAIN_EXTENSION_NAME)
+      extensions.emplace_back(extension);
+  }
+
+  return extensions;
 }
 
 vk::Format Settings::format() const
@@ -111,7 +152,7 @@ vk::ClearValue Settings::background_color() const
   return s_backColor;
 }
 
-const unsigned short& Settings::max_entities() const
+const EntityIndex& Settings::max_entities() const
 {
   return s_maxEntities;
 }
@@ -121,6 +162,36 @@ const unsigned short& Settings::max_components() const
   return s_maxComponents;
 }
 
+unsigned int Settings::worker_threads() const
+{
+  return s_workerThreads;
+}
+
+double Settings::time_step() const
+{
+  return s_timeStep;
+}
+
+unsigned long Settings::max_steps() const
+{
+  return s_maxSteps;
+}
+
+double Settings::max_time() const
+{
+  return s_maxTime;
+}
+
+unsigned long Settings::max_catch_up() const
+{
+  return s_maxCatchUp;
+}
+
+double Settings::frame_rate() const
+{
+  return s_frameRate;
+}
+
 Settings& Settings::update_name(std::string newName)
 {
   s_name = newName;
@@ -170,6 +241,18 @@ Settings& Settings::toggle_portability()
   return *this;
 }
 
+Settings& Settings::toggle_headless()
+{
+  s_headlessEnabled = !s_headlessEnabled;
+  return *this;
+}
+
+Settings& Settings::toggle_compute()
+{
+  s_computeEnabled = !s_computeEnabled;
+  return *this;
+}
+
 Settings& Settings::add_device_extension(const char * ext)
 {
   for (auto * extension : s_gpuExtensions)
@@ -236,15 +319,54 @@ Settings& Settings::update_background_color(vk::ClearValue color)
   return *this;
 }
 
-Settings& Settings::update_max_entities(unsigned short amount)
+Settings& Settings::update_max_entities(EntityIndex amount)
 {
-  s_maxEntities = amount;
+  s_maxEntities = std::min(amount, std::numeric_limits<EntityIndex>::max() - 1);
   return *this;
 }
 
 Settings& Settings::update_max_components(unsigned short amount)
 {
-  s_maxComponents = amount;
+  s_maxComponents = std::min<unsigned short>(amount, VECS_MAX_COMPONENTS);
+  return *this;
+}
+
+Settings& Settings::update_worker_threads(unsigned int threads)
+{
+  s_workerThreads = std::max(threads, 1u);
+  return *this;
+}
+
+Settings& Settings::update_time_step(double seconds)
+{
+  if (!(seconds > 0.0))
+    throw std::runtime_error("error @ Settings::update_time_step() : time step must be positive");
+
+  s_timeStep = seconds;
+  return *this;
+}
+
+Settings& Settings::update_max_steps(unsigned long steps)
+{
+  s_maxSteps = steps;
+  return *this;
+}
+
+Settings& Settings::update_max_time(double seconds)
+{
+  s_maxTime = std::max(seconds, 0.0);
+  return *this;
+}
+
+Settings& Settings::update_max_catch_up(unsigned long steps)
+{
+  s_maxCatchUp = std::max(steps, 1UL);
+  return *this;
+}
+
+Settings& Settings::update_frame_rate(double rate)
+{
+  s_frameRate = std::max(rate, 0.0);
   return *this;
 }
 
@@ -256,6 +378,8 @@ void Settings::set_default()
   s_width = 1280;
   s_height = 720;
   s_portabilityEnabled = false;
+  s_headlessEnabled = false;
+  s_computeEnabled = true;
   s_gpuExtensions = { VK_KHR_SWAPCHAIN_EXTENSION_NAME };
   s_format = vk::Format::eB8G8R8A8Srgb;
   s_colorSpace = vk::ColorSpaceKHR::eSrgbNonlinear;
@@ -268,6 +392,12 @@ void Settings::set_default()
   s_backColor = vk::ClearValue{vk::ClearColorValue{std::array<float, 4>{ 0.0025f, 0.01f, 0.005f, 1.0f }}};
   s_maxEntities = 20000;
   s_maxComponents = 100;
+  s_workerThreads = std::thread::hardware_concurrency();
+  s_timeStep = 1.0 / 60.0;
+  s_maxSteps = 0;
+  s_maxTime = 0.0;
+  s_maxCatchUp = 5;
+  s_frameRate = 0.0;
 }
 
 } // namespace vecs
\ No newline at end of file
@@ -6,19 +6,69 @@ namespace vecs
 Signature Signature::operator & (const Signature& rhs) const
 {
   Signature signature;
-  signature.bits = bits & rhs.bits;
+  for (unsigned long i = 0; i < word_count; ++i)
+    signature.bits[i] = bits[i] & rhs.bits[i];
+
+  return signature;
+}
+
+Signature Signature::operator | (const Signature& rhs) const
+{
+  Signature signature;
+  for (unsigned long i = 0; i < word_count; ++i)
+    signature.bits[i] = bits[i] | rhs.bits[i];
 
   return signature;
 }
 
 bool Signature::operator == (const Signature& rhs) const
 {
+  if constexpr (word_count == 1)
+    return bits[0] == rhs.bits[0];
+
   return bits == rhs.bits;
 }
 
+bool Signature::contains(const Signature& rhs) const
+{
+  if constexpr (word_count == 1)
+    return (bits[0] & rhs.bits[0]) == rhs.bits[0];
+
+  for (unsigned long i = 0; i < word_count; ++i)
+  {
+    if ((bits[i] & rhs.bits[i]) != rhs.bits[i])
+      return false;
+  }
+
+  return true;
+}
+
+bool Signature::intersects(const Signature& rhs) const
+{
+  if constexpr (word_count == 1)
+    return (bits[0] & rhs.bits[0]) != 0;
+
+  for (unsigned long i = 0; i < word_count; ++i)
+  {
+    if ((bits[i] & rhs.bits[i]) != 0)
+      return true;
+  }
+
+  return false;
+}
+
 void Signature::reset()
 {
-  bits.reset();
+  bits.fill(0);
+}
+
+std::size_t Signature::Hash::operator () (const Signature& signature) const
+{
+  std::uint64_t hash = 0;
+  for (std::uint64_t word : signature.bits)
+    hash = (hash ^ word) * 0x100000001B3;
+
+  return hash;
 }
 
 } // namespace vecs
\ No newline at end of file
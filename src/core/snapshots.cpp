@@ -0,0 +1,454 @@
+#include "src/core/include/snapshots.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace vecs
+{
+
+MappedFile::MappedFile(const std::string& path)
+{
+  int descriptor = ::open(path.c_str(), O_RDONLY);
+  if (descriptor < 0)
+    throw std::runtime_error("error @ MappedFile::MappedFile() : unable to open " + path);
+
+  struct stat status;
+  if (::fstat(descriptor, &status) != 0 || status.st_size == 0)
+  {
+    ::close(descriptor);
+    throw std::runtime_error("error @ MappedFile::MappedFile() : " + path + " is empty or unreadable");
+  }
+
+  f_size = status.st_size;
+  p_data = ::mmap(nullptr, f_size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+  ::close(descriptor);
+
+  if (p_data == MAP_FAILED)
+  {
+    p_data = nullptr;
+    throw std::runtime_error("error @ MappedFile::MappedFile() : unable to map " + path);
+  }
+
+  ::madvise(p_data, f_size, MADV_WILLNEED);
+}
+
+MappedFile::~MappedFile()
+{
+  if (p_data != nullptr)
+    ::munmap(p_data, f_size);
+}
+
+std::span<const std::byte> MappedFile::bytes() const
+{
+  return std::span<const std::byte>(static_cast<const std::byte *>(p_data), f_size);
+}
+
+Snapshot::Snapshot(std::string path)
+: file(std::move(path))
+{}
+
+const std::string& Snapshot::path() const
+{
+  return file;
+}
+
+void Snapshot::pad(std::ostream& stream)
+{
+  static constexpr std::array<char, alignment> zeros{};
+
+  std::streamoff position = stream.tellp();
+  if (position < 0) return;
+
+  unsigned long padding = (alignment - position % alignment) % alignment;
+  stream.write(zeros.data(), padding);
+}
+
+void Snapshot::check(const Header& header, std::uint32_t components)
+{
+  if (header.magic != Header{}.magic)
+    throw std::runtime_error("error @ Snapshot::load() : not a snapshot");
+
+  if (header.version != version)
+    throw std::runtime_error("error @ Snapshot::load() : unsupported snapshot version " + std::to_string(header.version));
+
+  if (header.indexSize != sizeof(EntityIndex))
+    throw std::runtime_error("error @ Snapshot::load() : snapshot was saved with " + std::to_string(header.indexSize * 8) + " bit entities");
+
+  if (header.components != components)
+    throw std::runtime_error("error @ Snapshot::load() : snapshot holds " + std::to_string(header.components) + " component types");
+}
+
+std::vector<std::uint64_t> Snapshot::mask(const EntityManager& e_manager, std::span<const Signature> singles)
+{
+  std::vector<std::uint64_t> masks(e_manager.signatures.size(), 0);
+  for (unsigned long i = 0; i < masks.size(); ++i)
+  {
+    for (unsigned long j = 0; j < singles.size(); ++j)
+    {
+      if (e_manager.signatures[i].contains(singles[j]))
+        masks[i] |= std::uint64_t{1} << j;
+    }
+  }
+
+  return masks;
+}
+
+std::vector<Signature> Snapshot::unmask(std::span<const std::uint64_t> masks, std::span<const Signature> singles)
+{
+  std::vector<Signature> signatures(masks.size());
+  for (unsigned long i = 0; i < masks.size(); ++i)
+  {
+    for (unsigned long j = 0; j < singles.size(); ++j)
+    {
+      if (masks[i] & (std::uint64_t{1} << j))
+        signatures[i] = signatures[i] | singles[j];
+    }
+  }
+
+  return signatures;
+}
+
+void Snapshot::restore(EntityManager& e_manager, ComponentManager& c_manager, std::span<const std::uint32_t> generations, std::span<const EntityIndex> freeIndices, std::span<const Entity> entities, std::vector<Signature> signatures)
+{
+  for (Entity entity : entities)
+  {
+    if (entity.index() >= generations.size() || entity.generation() != generations[entity.index()])
+      throw std::runtime_error("error @ Snapshot::load() : snapshot holds an invalid entity");
+  }
+
+  for (EntityIndex e_index : freeIndices)
+  {
+    if (e_index >= generations.size())
+      throw std::runtime_error("error @ Snapshot::load() : snapshot holds an invalid free index");
+  }
+
+  for (Entity entity : e_manager.entities)
+  {
+    c_manager.clear_data(entity);
+    for (const auto& query : e_manager.queries)
+      query->erase(entity);
+  }
+
+  e_manager.generations.assign(generations.begin(), generations.end());
+  e_manager.freeIndices.assign(freeIndices.begin(), freeIndices.end());
+  e_manager.entities.assign(entities.begin(), entities.end());
+  e_manager.signatures.assign(signatures.begin(), signatures.end());
+  e_manager.indices.assign(generations.size(), EntityManager::invalid);
+  ++e_manager.revision;
+
+  for (unsigned long index = 0; index < entities.size(); ++index)
+    e_manager.indices[entities[index].index()] = index;
+
+  if (e_manager.queries.empty()) return;
+
+  for (Entity entity : entities)
+    e_manager.refresh(entity);
+}
+
+Checkpoint::Checkpoint(std::string path, unsigned long interval)
+: file(std::move(path)), interval(interval)
+{}
+
+Checkpoint::~Checkpoint()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  ready.notify_all();
+
+  if (writer.joinable())
+    writer.join();
+}
+
+const std::string& Checkpoint::path() const
+{
+  return file;
+}
+
+unsigned long Checkpoint::records() const
+{
+  return written;
+}
+
+void Checkpoint::update(const EntityManager& e_manager, ComponentManager& c_manager)
+{
+  if (interval == 0) return;
+
+  if (++frames % interval == 0)
+    write(e_manager, c_manager);
+}
+
+void Checkpoint::write(const EntityManager& e_manager, ComponentManager& c_manager)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (error != nullptr)
+      std::rethrow_exception(std::exchange(error, nullptr));
+  }
+
+  std::uint32_t since = written == 0 ? 0 : boundary;
+  boundary = c_manager.advance_tick();
+
+  bool tables = written == 0 || e_manager.revision != revision;
+  revision = e_manager.revision;
+
+  std::vector<Signature> singles;
+  for (const auto& component : tracked)
+    singles.emplace_back(component.signature);
+
+  Record record;
+  record.components = tracked.size();
+  record.tables = tables;
+
+  if (tables)
+  {
+    record.indices = e_manager.generations.size();
+    record.entities = e_manager.entities.size();
+    record.free = e_manager.freeIndices.size();
+  }
+
+  auto job = std::make_unique<Job>();
+  job->mode = std::ios::binary | (written == 0 ? std::ios::trunc : std::ios::app);
+  append(job->head, std::span<const Record>(&record, 1));
+
+  if (tables)
+  {
+    append<std::uint32_t>(job->head, e_manager.generations);
+    append<EntityIndex>(job->head, e_manager.freeIndices);
+    append<Entity>(job->head, e_manager.entities);
+    append<std::uint64_t>(job->head, Snapshot::mask(e_manager, singles));
+  }
+
+  job->captures.resize(tracked.size());
+  for (unsigned long i = 0; i < tracked.size(); ++i)
+    tracked[i].capture(c_manager, since, job->captures[i]);
+
+  for (auto& capture : job->captures)
+  {
+    if (capture.pin == nullptr) continue;
+
+    std::lock_guard<std::mutex> lock(capture.pin->mutex);
+    if (capture.pin->active.load(std::memory_order_relaxed))
+      capture.pin->preserve();
+
+    capture.pin->preserve = [&capture](){ preserve(capture); };
+    capture.pin->active.store(true, std::memory_order_release);
+  }
+
+  ++written;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    jobs.emplace_back(std::move(job));
+
+    if (!writer.joinable())
+      writer = std::thread(&Checkpoint::work, this);
+  }
+  ready.notify_one();
+}
+
+void Checkpoint::wait()
+{
+  std::unique_lock<std::mutex> lock(mutex);
+  idle.wait(lock, [this](){ return jobs.empty(); });
+
+  if (error != nullptr)
+    std::rethrow_exception(std::exchange(error, nullptr));
+}
+
+void Checkpoint::work()
+{
+  while (true)
+  {
+    Job * job = nullptr;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      ready.wait(lock, [this](){ return stopping || !jobs.empty(); });
+
+      if (jobs.empty()) return;
+      job = jobs.front().get();
+    }
+
+    try
+    {
+      flush(*job);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (error == nullptr)
+        error = std::current_exception();
+    }
+
+    std::unique_ptr<Job> done;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      done = std::move(jobs.front());
+      jobs.pop_front();
+
+      if (jobs.empty())
+        idle.notify_all();
+    }
+  }
+}
+
+void Checkpoint::flush(Job& job)
+{
+  std::vector<std::byte> buffer = std::move(job.head);
+
+  try
+  {
+    for (auto& capture : job.captures)
+    {
+      std::unique_lock<std::mutex> lock;
+      if (capture.pin != nullptr)
+        lock = std::unique_lock<std::mutex>(capture.pin->mutex);
+
+      append<std::byte>(buffer, capture.head);
+      for (auto view : capture.views)
+        append(buffer, view);
+
+      if (capture.pin != nullptr && !capture.preserved)
+      {
+        capture.pin->preserve = nullptr;
+        capture.pin->active.store(false, std::memory_order_release);
+      }
+    }
+  }
+  catch (...)
+  {
+    release(job.captures);
+    throw;
+  }
+
+  buffer.resize((buffer.size() + Snapshot::alignment - 1) / Snapshot::alignment * Snapshot::alignment);
+
+  Record record;
+  std::memcpy(&record, buffer.data(), sizeof(Record));
+  record.bytes = buffer.size();
+  std::memcpy(buffer.data(), &record, sizeof(Record));
+
+  std::ofstream stream(file, job.mode);
+  stream.write(reinterpret_cast<const char *>(buffer.data()), buffer.size());
+
+  if (!stream)
+    throw std::runtime_error("error @ Checkpoint::write() : unable to write " + file);
+}
+
+void Checkpoint::preserve(Capture& capture)
+{
+  capture.copies.reserve(capture.views.size());
+  for (auto& view : capture.views)
+  {
+    capture.copies.emplace_back(view.begin(), view.end());
+    view = capture.copies.back();
+  }
+
+  capture.preserved = true;
+}
+
+void Checkpoint::release(std::span<Capture> captures)
+{
+  for (auto& capture : captures)
+  {
+    if (capture.pin == nullptr) continue;
+
+    std::lock_guard<std::mutex> lock(capture.pin->mutex);
+    if (!capture.preserved)
+    {
+      capture.pin->preserve = nullptr;
+      capture.pin->active.store(false, std::memory_order_release);
+    }
+  }
+}
+
+void Checkpoint::restore(EntityManager& e_manager, ComponentManager& c_manager)
+{
+  wait();
+
+  MappedFile mapped(file);
+  std::span<const std::byte> bytes = mapped.bytes();
+
+  std::span<const std::uint32_t> generations;
+  std::span<const EntityIndex> freeIndices;
+  std::span<const Entity> entities;
+  std::span<const std::uint64_t> masks;
+  std::vector<std::vector<unsigned long>> blocks(tracked.size());
+
+  unsigned long offset = 0;
+  unsigned long records = 0;
+  while (bytes.size() - offset >= sizeof(Record))
+  {
+    unsigned long start = offset;
+    const Record& record = Snapshot::read<Record>(bytes, offset, 1).front();
+
+    if (record.magic != Record{}.magic || record.version != version)
+      throw std::runtime_error("error @ Checkpoint::restore() : not a checkpoint");
+
+    if (record.indexSize != sizeof(EntityIndex) || record.components != tracked.size())
+      throw std::runtime_error("error @ Checkpoint::restore() : checkpoint does not match the tracked components");
+
+    if (record.bytes > bytes.size() - start || record.bytes < sizeof(Record)) break;
+
+    if (record.tables != 0)
+    {
+      generations = Snapshot::read<std::uint32_t>(bytes, offset, record.indices);
+      freeIndices = Snapshot::read<EntityIndex>(bytes, offset, record.free);
+      entities = Snapshot::read<Entity>(bytes, offset, record.entities);
+      masks = Snapshot::read<std::uint64_t>(bytes, offset, record.entities);
+    }
+    else if (records == 0)
+    {
+      throw std::runtime_error("error @ Checkpoint::restore() : checkpoint has no base record");
+    }
+
+    for (unsigned long i = 0; i < tracked.size(); ++i)
+    {
+      blocks[i].emplace_back(offset);
+      skip(bytes, offset, tracked[i]);
+    }
+
+    offset = start + record.bytes;
+    ++records;
+  }
+
+  if (records == 0)
+    throw std::runtime_error("error @ Checkpoint::restore() : " + file + " holds no complete checkpoint");
+
+  std::vector<Signature> singles;
+  for (const auto& component : tracked)
+    singles.emplace_back(component.signature);
+
+  Snapshot::restore(e_manager, c_manager, generations, freeIndices, entities, Snapshot::unmask(masks, singles));
+
+  for (unsigned long i = 0; i < tracked.size(); ++i)
+    tracked[i].replay(bytes, blocks[i], c_manager);
+
+  written = 0;
+  frames = 0;
+}
+
+void Checkpoint::skip(std::span<const std::byte> bytes, unsigned long& offset, const Tracked& component)
+{
+  const Block& block = Snapshot::read<Block>(bytes, offset, 1).front();
+  if (block.size != component.size || block.alignment != component.alignment || block.columns != component.columns || block.elements == 0)
+    throw std::runtime_error("error @ Checkpoint::restore() : checkpoint does not match the tracked components");
+
+  for (std::uint64_t chunk : Snapshot::read<std::uint64_t>(bytes, offset, block.chunks))
+  {
+    if (chunk >= (block.count + block.elements - 1) / block.elements)
+      throw std::runtime_error("error @ Checkpoint::restore() : checkpoint is corrupt");
+
+    unsigned long count = std::min(block.elements, block.count - chunk * block.elements);
+    Snapshot::read<Entity>(bytes, offset, count);
+    for (unsigned long column = 0; column < block.columns; ++column)
+      Snapshot::read<std::byte>(bytes, offset, count * block.size / block.columns);
+  }
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -0,0 +1,401 @@
+#include "src/core/include/spatial.hpp"
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace vecs
+{
+
+void SpatialIndex::rebuild(std::span<const Entity> entities, std::span<const Point> points, ThreadPool * pool)
+{
+  if (entities.size() != points.size())
+    throw std::runtime_error("error @ SpatialIndex::rebuild() : entity and point counts differ");
+
+  s_entities.assign(entities.begin(), entities.end());
+  s_points.assign(points.begin(), points.end());
+
+  bound();
+  build(pool);
+}
+
+unsigned long SpatialIndex::size() const
+{
+  return s_entities.size();
+}
+
+std::span<const Entity> SpatialIndex::entities() const
+{
+  return s_entities;
+}
+
+std::span<const Point> SpatialIndex::points() const
+{
+  return s_points;
+}
+
+std::vector<Entity> SpatialIndex::radius(const Point& center, float radius) const
+{
+  std::vector<Entity> found;
+  visit(center, radius, [&](unsigned long i){ found.push_back(s_entities[i]); });
+
+  return found;
+}
+
+std::vector<Entity> SpatialIndex::nearest(const Point& center, unsigned long count) const
+{
+  count = std::min(count, size());
+  if (count == 0)
+    return {};
+
+  float reach = 0.0f;
+  for (unsigned long axis = 0; axis < 3; ++axis)
+  {
+    float far = std::max(std::abs(center[axis] - s_min[axis]), std::abs(center[axis] - s_max[axis]));
+    reach += far * far;
+  }
+  reach = std::sqrt(reach);
+
+  std::vector<std::pair<float, unsigned long>> found;
+  for (float radius = std::max(spacing(), 1e-6f);; radius *= 2.0f)
+  {
+    if (radius >= reach)
+      radius = std::numeric_limits<float>::infinity();
+
+    found.clear();
+    visit(center, radius, [&](unsigned long i){ found.emplace_back(squared(center, s_points[i]), i); });
+
+    if (found.size() >= count || std::isinf(radius))
+      break;
+  }
+
+  count = std::min(count, found.size());
+  std::partial_sort(found.begin(), found.begin() + count, found.end(), [&](const auto& a, const auto& b){
+    return a.first != b.first ? a.first < b.first : s_entities[a.second] < s_entities[b.second];
+  });
+
+  std::vector<Entity> nearest(count);
+  for (unsigned long i = 0; i < count; ++i)
+    nearest[i] = s_entities[found[i].second];
+
+  return nearest;
+}
+
+float SpatialIndex::squared(const Point& a, const Point& b)
+{
+  float x = a[0] - b[0], y = a[1] - b[1], z = a[2] - b[2];
+  return x * x + y * y + z * z;
+}
+
+void SpatialIndex::run(ThreadPool * pool, unsigned long count, const std::function<void(unsigned long)>& task)
+{
+  if (pool == nullptr || count < 2)
+  {
+    for (unsigned long i = 0; i < count; ++i)
+      task(i);
+
+    return;
+  }
+
+  pool->parallel_for(count, task);
+}
+
+void SpatialIndex::bound()
+{
+  s_min = {};
+  s_max = {};
+  if (s_points.empty())
+    return;
+
+  s_min = s_points.front();
+  s_max = s_points.front();
+  for (const Point& point : s_points)
+  {
+    for (unsigned long axis = 0; axis < 3; ++axis)
+    {
+      s_min[axis] = std::min(s_min[axis], point[axis]);
+      s_max[axis] = std::max(s_max[axis], point[axis]);
+    }
+  }
+}
+
+SpatialGrid::SpatialGrid(float cellSize) : g_cellSize(cellSize)
+{
+  if (!(cellSize > 0.0f))
+    throw std::runtime_error("error @ SpatialGrid::SpatialGrid() : cell size must be positive");
+}
+
+float SpatialGrid::cell_size() const
+{
+  return g_cellSize;
+}
+
+std::span<const Entity> SpatialGrid::cell(const Point& point) const
+{
+  if (s_entities.empty())
+    return {};
+
+  unsigned long b = bucket(coordinates(point));
+  return std::span<const Entity>(s_entities).subspan(g_starts[b], g_starts[b + 1] - g_starts[b]);
+}
+
+void SpatialGrid::build(ThreadPool * pool)
+{
+  unsigned long count = s_entities.size();
+  g_starts.assign(std::bit_ceil(std::max(2 * count, 1UL)) + 1, 0);
+
+  std::vector<unsigned long> keys(count);
+  unsigned long batches = (count + batch_size - 1) / batch_size;
+  run(pool, batches, [&](unsigned long batch){
+    unsigned long last = std::min(count, (batch + 1) * batch_size);
+    for (unsigned long i = batch * batch_size; i < last; ++i)
+      keys[i] = bucket(coordinates(s_points[i]));
+  });
+
+  for (unsigned long key : keys)
+    ++g_starts[key + 1];
+
+  for (unsigned long b = 1; b < g_starts.size(); ++b)
+    g_starts[b] += g_starts[b - 1];
+
+  std::vector<unsigned long> order(count);
+  std::vector<unsigned long> next(g_starts.begin(), g_starts.end() - 1);
+  for (unsigned long i = 0; i < count; ++i)
+    order[next[keys[i]]++] = i;
+
+  std::vector<Entity> entities(count);
+  std::vector<Point> points(count);
+  run(pool, batches, [&](unsigned long batch){
+    unsigned long last = std::min(count, (batch + 1) * batch_size);
+    for (unsigned long i = batch * batch_size; i < last; ++i)
+    {
+      entities[i] = s_entities[order[i]];
+      points[i] = s_points[order[i]];
+    }
+  });
+
+  s_entities.swap(entities);
+  s_points.swap(points);
+}
+
+void SpatialGrid::visit(const Point& center, float radius, const std::function<void(unsigned long)>& f) const
+{
+  if (s_entities.empty() || radius < 0.0f)
+    return;
+
+  float limit = radius * radius;
+
+  bool scan = false;
+  for (unsigned long axis = 0; axis < 3; ++axis)
+    scan = scan || !((std::abs(static_cast<double>(center[axis])) + radius) / g_cellSize < max_cell);
+
+  std::array<std::int64_t, 3> low{}, high{};
+  double cells = 1.0;
+  if (!scan)
+  {
+    low = coordinates({ center[0] - radius, center[1] - radius, center[2] - radius });
+    high = coordinates({ center[0] + radius, center[1] + radius, center[2] + radius });
+
+    for (unsigned long axis = 0; axis < 3; ++axis)
+      cells *= static_cast<double>(high[axis] - low[axis] + 1);
+
+    scan = cells >= static_cast<double>(g_starts.size() - 1);
+  }
+
+  if (scan)
+  {
+    for (unsigned long i = 0; i < s_points.size(); ++i)
+    {
+      if (squared(center, s_points[i]) <= limit)
+        f(i);
+    }
+
+    return;
+  }
+
+  std::vector<unsigned long> buckets;
+  buckets.reserve(static_cast<unsigned long>(cells));
+  for (std::int64_t x = low[0]; x <= high[0]; ++x)
+    for (std::int64_t y = low[1]; y <= high[1]; ++y)
+      for (std::int64_t z = low[2]; z <= high[2]; ++z)
+        buckets.push_back(bucket({ x, y, z }));
+
+  std::sort(buckets.begin(), buckets.end());
+  buckets.erase(std::unique(buckets.begin(), buckets.end()), buckets.end());
+
+  for (unsigned long b : buckets)
+  {
+    for (unsigned long i = g_starts[b]; i < g_starts[b + 1]; ++i)
+    {
+      if (squared(center, s_points[i]) <= limit)
+        f(i);
+    }
+  }
+}
+
+float SpatialGrid::spacing() const
+{
+  return g_cellSize;
+}
+
+std::array<std::int64_t, 3> SpatialGrid::coordinates(const Point& point) const
+{
+  std::array<std::int64_t, 3> cell{};
+  for (unsigned long axis = 0; axis < 3; ++axis)
+  {
+    double value = std::floor(static_cast<double>(point[axis]) / g_cellSize);
+    cell[axis] = value < max_cell ? (value > -max_cell ? static_cast<std::int64_t>(value) : -static_cast<std::int64_t>(max_cell)) : static_cast<std::int64_t>(max_cell);
+  }
+
+  return cell;
+}
+
+unsigned long SpatialGrid::bucket(const std::array<std::int64_t, 3>& cell) const
+{
+  std::uint64_t hash = static_cast<std::uint64_t>(cell[0]) * 73856093ULL
+                     ^ static_cast<std::uint64_t>(cell[1]) * 19349663ULL
+                     ^ static_cast<std::uint64_t>(cell[2]) * 83492791ULL;
+
+  return hash & (g_starts.size() - 2);
+}
+
+SpatialTree::SpatialTree(unsigned long leafSize) : t_leafSize(std::max(leafSize, 1UL))
+{
+}
+
+unsigned long SpatialTree::node_count() const
+{
+  return t_nodes.size();
+}
+
+void SpatialTree::build(ThreadPool * pool)
+{
+  unsigned long count = s_entities.size();
+  t_nodes.assign(count == 0 ? 0 : nodes(count), Node{});
+  if (count == 0)
+    return;
+
+  std::vector<unsigned long> order(count);
+  for (unsigned long i = 0; i < count; ++i)
+    order[i] = i;
+
+  split(pool, order, 0, 0, count);
+
+  std::vector<Entity> entities(count);
+  std::vector<Point> points(count);
+  for (unsigned long i = 0; i < count; ++i)
+  {
+    entities[i] = s_entities[order[i]];
+    points[i] = s_points[order[i]];
+  }
+
+  s_entities.swap(entities);
+  s_points.swap(points);
+}
+
+void SpatialTree::visit(const Point& center, float radius, const std::function<void(unsigned long)>& f) const
+{
+  if (t_nodes.empty() || radius < 0.0f)
+    return;
+
+  float limit = radius * radius;
+  std::vector<unsigned long> stack = { 0 };
+  while (!stack.empty())
+  {
+    unsigned long index = stack.back();
+    const Node& node = t_nodes[index];
+    stack.pop_back();
+
+    float gap = 0.0f;
+    for (unsigned long axis = 0; axis < 3; ++axis)
+    {
+      float d = std::max({ node.min[axis] - center[axis], 0.0f, center[axis] - node.max[axis] });
+      gap += d * d;
+    }
+
+    if (gap > limit)
+      continue;
+
+    if (node.right == 0)
+    {
+      for (unsigned long i = node.first; i < node.first + node.count; ++i)
+      {
+        if (squared(center, s_points[i]) <= limit)
+          f(i);
+      }
+
+      continue;
+    }
+
+    stack.push_back(node.right);
+    stack.push_back(index + 1);
+  }
+}
+
+float SpatialTree::spacing() const
+{
+  float extent = std::max({ s_max[0] - s_min[0], s_max[1] - s_min[1], s_max[2] - s_min[2] });
+  float spacing = extent / std::cbrt(static_cast<float>(std::max(size(), 1UL)));
+
+  return spacing > 0.0f ? spacing : 1.0f;
+}
+
+unsigned long SpatialTree::nodes(unsigned long count) const
+{
+  return count <= t_leafSize ? 1 : 1 + nodes(count / 2) + nodes(count - count / 2);
+}
+
+void SpatialTree::split(ThreadPool * pool, std::vector<unsigned long>& order, unsigned long index, unsigned long first, unsigned long count)
+{
+  Node& node = t_nodes[index];
+  node.first = first;
+  node.count = count;
+  node.min = s_points[order[first]];
+  node.max = s_points[order[first]];
+  for (unsigned long i = first; i < first + count; ++i)
+  {
+    for (unsigned long axis = 0; axis < 3; ++axis)
+    {
+      node.min[axis] = std::min(node.min[axis], s_points[order[i]][axis]);
+      node.max[axis] = std::max(node.max[axis], s_points[order[i]][axis]);
+    }
+  }
+
+  if (count <= t_leafSize)
+    return;
+
+  unsigned long axis = 0;
+  for (unsigned long a = 1; a < 3; ++a)
+  {
+    if (node.max[a] - node.min[a] > node.max[axis] - node.min[axis])
+      axis = a;
+  }
+
+  unsigned long half = count / 2;
+  auto begin = order.begin() + first;
+  std::nth_element(begin, begin + half, begin + count, [&](unsigned long a, unsigned long b){
+    return s_points[a][axis] < s_points[b][axis];
+  });
+
+  unsigned long left = index + 1;
+  unsigned long right = left + nodes(half);
+  node.right = right;
+
+  auto child = [&](unsigned long i){
+    if (i == 0)
+      split(pool, order, left, first, half);
+    else
+      split(pool, order, right, first + half, count - half);
+  };
+
+  if (pool != nullptr && count >= 2 * batch_size)
+    pool->parallel_for(2, child);
+  else
+  {
+    child(0);
+    child(1);
+  }
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -1,11 +1,165 @@
 #include "src/core/include/systems.hpp"
 
+#include <algorithm>
+
 namespace vecs
 {
 
+void System::update(const std::shared_ptr<ComponentManager>& c_manager, const std::set<Entity>& e_ids)
+{
+  std::vector<Entity> entities(e_ids.begin(), e_ids.end());
+  update(c_manager, View(entities));
+}
+
+void System::update_archetypes(const std::shared_ptr<ArchetypeManager>&, std::span<const std::shared_ptr<Archetype>>)
+{}
+
 const Signature& System::signature() const
 {
   return sys_signature;
 }
 
+const Signature& System::reads() const
+{
+  return sys_reads;
+}
+
+const Signature& System::writes() const
+{
+  return sys_writes;
+}
+
+bool System::conflicts(const System& other) const
+{
+  if (exclusive() || other.exclusive()) return true;
+
+  return sys_writes.intersects(other.sys_reads | other.sys_writes) || other.sys_writes.intersects(sys_reads);
+}
+
+std::uint32_t System::last_tick() const
+{
+  return sys_tick;
+}
+
+ThreadPool * System::thread_pool() const
+{
+  return sys_pool.get();
+}
+
+bool System::exclusive() const
+{
+  return sys_reads == Signature{} && sys_writes == Signature{};
+}
+
+CommandBuffer& System::commands() const
+{
+  return sys_commands->local();
+}
+
+void System::run(unsigned long count, const std::function<void(unsigned long)>& task) const
+{
+  if (sys_pool == nullptr || count < 2)
+  {
+    for (unsigned long i = 0; i < count; ++i)
+      task(i);
+
+    return;
+  }
+
+  sys_pool->parallel_for(count, task);
+}
+
+void SystemManager::update(const std::shared_ptr<ComponentManager>& c_manager, EntityManager& e_manager)
+{
+  track(e_manager);
+  if (modified) schedule();
+
+  for (const auto& stage : stages)
+  {
+    std::uint32_t tick = c_manager->advance_tick();
+
+    if (stage.size() == 1)
+    {
+      systems[stage.front()]->update(c_manager, queries[stage.front()]->view());
+    }
+    else
+    {
+      pool->parallel_for(stage.size(), [&](unsigned long i){
+        systems[stage[i]]->update(c_manager, queries[stage[i]]->view());
+      });
+    }
+
+    for (unsigned long index : stage)
+      systems[index]->sys_tick = tick;
+
+    c_manager->advance_tick();
+    commands->flush(e_manager, *c_manager);
+  }
+}
+
+void SystemManager::update(const std::shared_ptr<ArchetypeManager>& a_manager)
+{
+  if (modified) schedule();
+
+  for (const auto& stage : stages)
+  {
+    if (stage.size() == 1)
+    {
+      auto& system = systems[stage.front()];
+      system->update_archetypes(a_manager, a_manager->query(system->signature()));
+    }
+    else
+    {
+      pool->parallel_for(stage.size(), [&](unsigned long i){
+        auto& system = systems[stage[i]];
+        system->update_archetypes(a_manager, a_manager->query(system->signature()));
+      });
+    }
+  }
+}
+
+void SystemManager::track(EntityManager& e_manager)
+{
+  if (tracked != e_manager.id)
+  {
+    queries.clear();
+    tracked = e_manager.id;
+  }
+
+  queries.resize(systems.size());
+  for (unsigned long id = 0; id < systems.size(); ++id)
+  {
+    if (queries[id] != nullptr && (systems[id] == nullptr || !(queries[id]->signature() == systems[id]->signature())))
+    {
+      e_manager.unregister_query(queries[id]);
+      queries[id] = nullptr;
+    }
+
+    if (systems[id] != nullptr && queries[id] == nullptr)
+      queries[id] = e_manager.register_query(systems[id]->signature());
+  }
+}
+
+void SystemManager::schedule()
+{
+  stages.clear();
+  std::vector<unsigned long> levels(order.size(), 0);
+
+  for (unsigned long j = 0; j < order.size(); ++j)
+  {
+    for (unsigned long i = 0; i < j; ++i)
+    {
+      if (systems[order[i]]->conflicts(*systems[order[j]]))
+        levels[j] = std::max(levels[j], levels[i] + 1);
+    }
+
+    if (levels[j] >= stages.size())
+      stages.resize(levels[j] + 1);
+
+    stages[levels[j]].emplace_back(order[j]);
+  }
+
+  modified = false;
+}
+
 } // namespace vecs
\ No newline at end of file
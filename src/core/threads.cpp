@@ -0,0 +1,217 @@
+#include "src/core/include/threads.hpp"
+
+#include <algorithm>
+
+namespace vecs
+{
+
+static thread_local ThreadPool * t_pool = nullptr;
+static thread_local unsigned long t_index = 0;
+
+ThreadPool::ThreadPool(unsigned int threads)
+{
+  threads = std::max(threads, 1u);
+
+  for (unsigned int i = 0; i < threads; ++i)
+    queues.emplace_back(std::make_unique<Queue>());
+
+  for (unsigned int i = 0; i < threads; ++i)
+    workers.emplace_back(&ThreadPool::work, this, i);
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  taskReady.notify_all();
+
+  for (auto& worker : workers)
+    worker.join();
+}
+
+unsigned int ThreadPool::size() const
+{
+  return workers.size();
+}
+
+void ThreadPool::submit(std::function<void()> task)
+{
+  pending.fetch_add(1);
+  queued.fetch_add(1);
+
+  auto& queue = *queues[current()];
+  {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    queue.tasks.emplace_back(Task{ .loop = nullptr, .job = std::move(task), .index = 0 });
+  }
+
+  wake(1);
+}
+
+void ThreadPool::wait()
+{
+  unsigned long index = current();
+  while (runOne(index));
+
+  std::unique_lock<std::mutex> lock(mutex);
+  tasksDone.wait(lock, [this](){ return pending.load() == 0; });
+
+  if (error == nullptr) return;
+
+  std::exception_ptr e = error;
+  error = nullptr;
+  std::rethrow_exception(e);
+}
+
+void ThreadPool::parallel_for(unsigned long count, const std::function<void(unsigned long)>& task)
+{
+  if (count == 0) return;
+
+  Loop loop{ .task = task, .remaining = count, .mutex = {}, .failure = nullptr };
+
+  pending.fetch_add(count);
+  queued.fetch_add(count);
+
+  unsigned long first = current();
+  for (unsigned long q = 0; q < queues.size() && q < count; ++q)
+  {
+    auto& queue = *queues[(first + q) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+
+    for (unsigned long i = q; i < count; i += queues.size())
+      queue.tasks.emplace_back(Task{ .loop = &loop, .job = nullptr, .index = i });
+  }
+
+  wake(count);
+
+  while (loop.remaining.load() != 0)
+  {
+    if (runOne(first)) continue;
+
+    unsigned long seen = finished.load();
+    if (loop.remaining.load() != 0) finished.wait(seen);
+  }
+
+  if (loop.failure != nullptr)
+    std::rethrow_exception(loop.failure);
+}
+
+unsigned long ThreadPool::current()
+{
+  if (t_pool == this) return t_index;
+
+  return nextQueue.fetch_add(1, std::memory_order_relaxed) % queues.size();
+}
+
+void ThreadPool::wake(unsigned long count)
+{
+  if (sleeping.load() == 0) return;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+  }
+
+  if (count == 1) taskReady.notify_one();
+  else taskReady.notify_all();
+}
+
+bool ThreadPool::take(unsigned long index, Task& task)
+{
+  {
+    auto& queue = *queues[index];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.back());
+      queue.tasks.pop_back();
+      return true;
+    }
+  }
+
+  for (unsigned long i = 1; i < queues.size(); ++i)
+  {
+    auto& queue = *queues[(index + i) % queues.size()];
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (!queue.tasks.empty())
+    {
+      task = std::move(queue.tasks.front());
+      queue.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+bool ThreadPool::runOne(unsigned long index)
+{
+  Task task{ .loop = nullptr, .job = nullptr, .index = 0 };
+  if (!take(index, task)) return false;
+
+  queued.fetch_sub(1);
+
+  if (task.loop != nullptr) runLoop(*task.loop, task.index);
+  else runJob(task.job);
+
+  if (pending.fetch_sub(1) == 1)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    tasksDone.notify_all();
+  }
+
+  return true;
+}
+
+void ThreadPool::runLoop(Loop& loop, unsigned long index)
+{
+  try
+  {
+    loop.task(index);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(loop.mutex);
+    if (loop.failure == nullptr) loop.failure = std::current_exception();
+  }
+
+  if (loop.remaining.fetch_sub(1) != 1) return;
+
+  finished.fetch_add(1);
+  finished.notify_all();
+}
+
+void ThreadPool::runJob(std::function<void()>& job)
+{
+  try
+  {
+    job();
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (error == nullptr) error = std::current_exception();
+  }
+}
+
+void ThreadPool::work(unsigned long index)
+{
+  t_pool = this;
+  t_index = index;
+
+  while (true)
+  {
+    if (runOne(index)) continue;
+
+    std::unique_lock<std::mutex> lock(mutex);
+
+    sleeping.fetch_add(1);
+    taskReady.wait(lock, [this](){ return stopping || queued.load() != 0; });
+    sleeping.fetch_sub(1);
+
+    if (stopping && queued.load() == 0) return;
+  }
+}
+
+} // namespace vecs
\ No newline at end of file
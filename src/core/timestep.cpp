@@ -0,0 +1,90 @@
+#include "src/core/include/timestep.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace vecs
+{
+
+Timestep::Timestep(double step, unsigned long maxCatchUp, double frameRate)
+: ts_step(step), ts_maxCatchUp(std::max(maxCatchUp, 1UL)), ts_frameRate(std::max(frameRate, 0.0))
+{
+  if (!(step > 0.0))
+    throw std::runtime_error("error @ Timestep::Timestep() : step must be positive");
+}
+
+bool Timestep::present(double seconds)
+{
+  if (ts_frameRate > 0.0)
+  {
+    double interval = 1.0 / ts_frameRate;
+
+    ts_frameAccumulator += seconds > 0.0 ? seconds : 0.0;
+    if (ts_frameAccumulator < interval)
+      return false;
+
+    ts_frameAccumulator = std::fmod(ts_frameAccumulator, interval);
+  }
+
+  ++ts_stats.frames;
+  return true;
+}
+
+double Timestep::step() const
+{
+  return ts_step;
+}
+
+unsigned long Timestep::max_catch_up() const
+{
+  return ts_maxCatchUp;
+}
+
+double Timestep::frame_rate() const
+{
+  return ts_frameRate;
+}
+
+unsigned long Timestep::ticks() const
+{
+  return ts_stats.ticks;
+}
+
+double Timestep::time() const
+{
+  return static_cast<double>(ts_stats.ticks) * ts_step;
+}
+
+double Timestep::alpha() const
+{
+  return ts_accumulator / ts_step;
+}
+
+const Timestep::Stats& Timestep::stats() const
+{
+  return ts_stats;
+}
+
+void Timestep::record(double seconds)
+{
+  ++ts_stats.ticks;
+  ts_stats.last = seconds;
+  ts_stats.average += (seconds - ts_stats.average) / static_cast<double>(ts_stats.ticks);
+  ts_stats.peak = std::max(ts_stats.peak, seconds);
+}
+
+void Timestep::settle()
+{
+  if (ts_accumulator >= ts_step)
+  {
+    double skipped = std::floor(ts_accumulator / ts_step);
+
+    ts_stats.skipped += static_cast<unsigned long>(skipped);
+    ts_accumulator = std::fmod(ts_accumulator, ts_step);
+  }
+
+  ts_stats.lag = ts_accumulator;
+}
+
+} // namespace vecs
\ No newline at end of file
@@ -0,0 +1,226 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+TEST_CASE( "archetype_new_entity", "[archetypes][new]" )
+{
+  vecs::EntityManager e_manager;
+  TEST::ArchetypeManager manager(e_manager);
+
+  for (unsigned long i = 0; i < 5; ++i)
+    CHECK( manager.new_entity() == vecs::Entity(i) );
+
+  CHECK( manager.count() == 5 );
+  CHECK( manager.archetype_count() == 1 );
+}
+
+TEST_CASE( "archetype_remove_entity", "[archetypes][remove]" )
+{
+  vecs::EntityManager e_manager;
+  TEST::ArchetypeManager manager(e_manager);
+
+  for (unsigned long i = 0; i < 5; ++i)
+    manager.new_entity();
+
+  manager.remove_entity(vecs::Entity(2));
+
+  CHECK( manager.count() == 4 );
+  CHECK( !manager.valid(vecs::Entity(2)) );
+  CHECK( manager.new_entity() == vecs::Entity(2, 1) );
+  CHECK( !manager.valid(vecs::Entity(2)) );
+}
+
+TEST_CASE( "archetype_add_components", "[archetypes][addcomponents]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  vecs::EntityManager e_manager;
+  TEST::ArchetypeManager manager(e_manager);
+
+  auto e_id = manager.new_entity();
+  manager.add_components<TestType1>(e_id, { 1 });
+
+  SECTION( "single" )
+  {
+    REQUIRE( manager.retrieve<TestType1>(e_id).has_value() );
+    CHECK( manager.retrieve<TestType1>(e_id).value().a == 1 );
+    CHECK( !manager.retrieve<TestType2>(e_id).has_value() );
+    CHECK( manager.archetype_count() == 2 );
+  }
+
+  SECTION( "move_table" )
+  {
+    manager.add_components<TestType2>(e_id, { 2 });
+
+    CHECK( manager.retrieve<TestType1>(e_id).value().a == 1 );
+    CHECK( manager.retrieve<TestType2>(e_id).value().b == 2 );
+    CHECK( manager.archetype_count() == 3 );
+  }
+
+  SECTION( "get" )
+  {
+    manager.get<TestType1>(e_id).a = 4;
+
+    CHECK( manager.retrieve<TestType1>(e_id).value().a == 4 );
+    CHECK( manager.try_get<TestType2>(e_id) == nullptr );
+    CHECK_THROWS( manager.get<TestType2>(e_id) );
+  }
+
+  SECTION( "overwrite" )
+  {
+    manager.add_components<TestType1>(e_id, { 3 });
+
+    CHECK( manager.retrieve<TestType1>(e_id).value().a == 3 );
+    CHECK( manager.archetype_count() == 2 );
+  }
+
+  SECTION( "round_trip" )
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      manager.add_components<TestType2>(e_id, { i });
+      CHECK( manager.retrieve<TestType2>(e_id).value().b == i );
+
+      manager.remove_components<TestType2>(e_id);
+      CHECK( !manager.retrieve<TestType2>(e_id).has_value() );
+    }
+
+    auto other = manager.new_entity();
+    manager.add_components<TestType2, TestType1>(other, { 5 }, { 6 });
+
+    CHECK( manager.retrieve<TestType1>(e_id).value().a == 1 );
+    CHECK( manager.retrieve<TestType1>(other).value().a == 6 );
+    CHECK( manager.archetype_count() == 3 );
+  }
+}
+
+TEST_CASE( "archetype_remove_components", "[archetypes][removecomponents]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  vecs::EntityManager e_manager;
+  TEST::ArchetypeManager manager(e_manager);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    auto e_id = manager.new_entity();
+    manager.add_components<TestType1, TestType2>(e_id, { i }, { i * 10 });
+  }
+
+  manager.remove_components<TestType2>(vecs::Entity(0));
+
+  CHECK( manager.retrieve<TestType1>(vecs::Entity(0)).value().a == 0 );
+  CHECK( !manager.retrieve<TestType2>(vecs::Entity(0)).has_value() );
+
+  CHECK( manager.retrieve<TestType1>(vecs::Entity(2)).value().a == 2 );
+  CHECK( manager.retrieve<TestType2>(vecs::Entity(2)).value().b == 20 );
+}
+
+TEST_CASE( "archetype_query", "[archetypes][query]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  vecs::EntityManager e_manager;
+  TEST::ArchetypeManager manager(e_manager);
+
+  for (int i = 0; i < 4; ++i)
+  {
+    auto e_id = manager.new_entity();
+    manager.add_components<TestType1>(e_id, { i });
+  }
+  manager.add_components<TestType2>(vecs::Entity(3), { 5 });
+
+  CHECK( manager.query<TestType1>().size() == 2 );
+  CHECK( manager.query<TestType1>(true).size() == 1 );
+  CHECK( manager.query<TestType1, TestType2>().size() == 1 );
+
+  int sum = 0;
+  manager.each<TestType1>([&sum](vecs::Entity, TestType1& t1){ sum += t1.a; });
+  CHECK( sum == 6 );
+
+  manager.each<TestType1, TestType2>([](vecs::Entity, TestType1& t1, TestType2& t2){ t1.a *= t2.b; });
+  CHECK( manager.retrieve<TestType1>(vecs::Entity(3)).value().a == 15 );
+}
+
+TEST_CASE( "archetype_entity_manager", "[archetypes][entitymanager]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  vecs::EntityManager e_manager;
+  TEST::ArchetypeManager manager(e_manager);
+
+  auto query = e_manager.register_query<TestType1>();
+
+  for (int i = 0; i < 4; ++i)
+  {
+    auto e_id = manager.new_entity();
+    manager.add_components<TestType1>(e_id, { i });
+  }
+
+  SECTION( "view" )
+  {
+    CHECK( e_manager.count() == 4 );
+    CHECK( e_manager.retrieve<TestType1>().size() == 4 );
+    CHECK( query->size() == 4 );
+
+    manager.remove_components<TestType1>(vecs::Entity(1));
+    manager.add_components<TestType2>(vecs::Entity(2), { 5 });
+
+    CHECK( query->size() == 3 );
+    CHECK( e_manager.retrieve<TestType1, TestType2>().size() == 1 );
+  }
+
+  SECTION( "adopt" )
+  {
+    auto e_id = e_manager.new_entity();
+    manager.add_components<TestType1>(e_id, { 7 });
+
+    CHECK( manager.retrieve<TestType1>(e_id).value().a == 7 );
+    CHECK( manager.query<TestType1>().front()->size() == 5 );
+  }
+
+  SECTION( "stale" )
+  {
+    e_manager.remove_entity(vecs::Entity(1));
+    CHECK( !manager.retrieve<TestType1>(vecs::Entity(1)).has_value() );
+
+    auto e_id = manager.new_entity();
+    REQUIRE( e_id == vecs::Entity(1, 1) );
+
+    CHECK( !manager.retrieve<TestType1>(e_id).has_value() );
+    CHECK( manager.query<TestType1>().front()->size() == 3 );
+    CHECK( manager.retrieve<TestType1>(vecs::Entity(3)).value().a == 3 );
+  }
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <numeric>
+
+TEST_CASE( "chunk_pool", "[chunks][pool]" )
+{
+  vecs::ChunkPool pool;
+
+  void * p_chunk = pool.allocate(vecs::ChunkPool::chunk_size);
+  pool.release(p_chunk, vecs::ChunkPool::chunk_size);
+
+  CHECK( pool.pooled() == 1 );
+  CHECK( pool.allocate(vecs::ChunkPool::chunk_size) == p_chunk );
+  CHECK( pool.pooled() == 0 );
+
+  pool.release(p_chunk, vecs::ChunkPool::chunk_size);
+  pool.trim();
+
+  CHECK( pool.pooled() == 0 );
+}
+
+TEST_CASE( "chunked_array", "[chunks][array]" )
+{
+  auto pool = std::make_shared<vecs::ChunkPool>();
+  vecs::ChunkedArray<int> array(pool);
+
+  unsigned long count = 3 * array.chunk_elements + 5;
+  for (unsigned long i = 0; i < count; ++i)
+    array.push_back(i);
+
+  REQUIRE( array.size() == count );
+  CHECK( array.chunk_count() == 4 );
+  CHECK( array.chunk(3).size() == 5 );
+  CHECK( array[array.chunk_elements + 1] == static_cast<int>(array.chunk_elements + 1) );
+
+  SECTION( "stable" )
+  {
+    int * p_first = &array[0];
+
+    for (unsigned long i = 0; i < 4 * array.chunk_elements; ++i)
+      array.push_back(0);
+
+    CHECK( &array[0] == p_first );
+  }
+
+  SECTION( "iteration" )
+  {
+    long sum = std::accumulate(array.begin(), array.end(), 0l);
+
+    CHECK( sum == static_cast<long>(count * (count - 1) / 2) );
+  }
+
+  SECTION( "shrink" )
+  {
+    while (array.size() > 1)
+      array.pop_back();
+
+    CHECK( array.chunk_count() == 1 );
+    CHECK( pool->pooled() == 2 );
+
+    array.clear();
+
+    CHECK( array.empty() );
+    CHECK( pool->pooled() == 3 );
+  }
+
+  SECTION( "append" )
+  {
+    std::vector<int> values(2 * array.chunk_elements, 7);
+    array.append(values);
+
+    CHECK( array.size() == count + values.size() );
+    CHECK( array[count - 1] == static_cast<int>(count - 1) );
+    CHECK( array[count] == 7 );
+    CHECK( array[array.size() - 1] == 7 );
+  }
+
+  SECTION( "copy" )
+  {
+    vecs::ChunkedArray<int> copy = array;
+    copy[0] = 100;
+
+    CHECK( copy.size() == count );
+    CHECK( array[0] == 0 );
+
+    vecs::ChunkedArray<int> moved = std::move(copy);
+
+    CHECK( moved.size() == count );
+    CHECK( moved[0] == 100 );
+    CHECK( copy.empty() );
+  }
+}
\ No newline at end of file
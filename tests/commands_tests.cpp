@@ -0,0 +1,205 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <string>
+#include <vector>
+
+TEST_CASE( "command_spawn", "[commands][spawn]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::CommandBuffer buffer;
+
+  auto e_id = buffer.spawn();
+  buffer.add_components(e_id, TestType1{ 5 });
+  buffer.spawn();
+
+  CHECK( buffer.size() == 3 );
+  CHECK( e_manager.count() == 0 );
+
+  buffer.flush(e_manager, c_manager);
+
+  CHECK( buffer.empty() );
+  CHECK( e_manager.count() == 2 );
+  CHECK( e_manager.retrieve<TestType1>() == std::set<vecs::Entity>{ vecs::Entity(0) } );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(0)).a == 5 );
+
+  SECTION( "limit" )
+  {
+    VECS_SETTINGS.update_max_entities(4);
+
+    for (int i = 0; i < 4; ++i)
+      buffer.add_components(buffer.spawn(), TestType1{ i });
+
+    buffer.flush(e_manager, c_manager);
+
+    CHECK( e_manager.count() == 4 );
+    CHECK( e_manager.retrieve<TestType1>().size() == 3 );
+    CHECK( c_manager.get<TestType1>(vecs::Entity(3)).a == 1 );
+    CHECK( c_manager.try_get<TestType1>(vecs::Entity(4)) == nullptr );
+
+    VECS_SETTINGS.set_default();
+  }
+}
+
+TEST_CASE( "command_despawn", "[commands][despawn]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::CommandBuffer buffer;
+
+  auto e_id = e_manager.new_entity();
+  buffer.add_components(e_id, TestType1{});
+  buffer.flush(e_manager, c_manager);
+
+  buffer.despawn(e_id);
+  buffer.add_components(e_id, TestType1{ 2 });
+  buffer.flush(e_manager, c_manager);
+
+  CHECK( !e_manager.valid(e_id) );
+  CHECK( c_manager.try_get<TestType1>(e_id) == nullptr );
+
+  SECTION( "stale" )
+  {
+    buffer.add_components(e_id, TestType1{ 3 });
+    buffer.despawn(e_id);
+    buffer.flush(e_manager, c_manager);
+
+    CHECK( e_manager.count() == 0 );
+    CHECK( c_manager.try_get<TestType1>(e_id) == nullptr );
+  }
+}
+
+TEST_CASE( "command_coalesce", "[commands][coalesce]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    int b = 1;
+  };
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::CommandBuffer buffer;
+
+  auto e_id = e_manager.new_entity();
+
+  buffer.add_components(e_id, TestType1{ 1 }, TestType2{ 1 });
+  buffer.add_components(e_id, TestType1{ 2 });
+  buffer.remove_components<TestType2>(e_id);
+  buffer.flush(e_manager, c_manager);
+
+  CHECK( c_manager.get<TestType1>(e_id).a == 2 );
+  CHECK( c_manager.try_get<TestType2>(e_id) == nullptr );
+  CHECK( e_manager.retrieve<TestType1>() == std::set<vecs::Entity>{ e_id } );
+  CHECK( e_manager.retrieve<TestType2>().empty() );
+}
+
+TEST_CASE( "command_pending", "[commands][pending]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::CommandBuffer buffer1;
+  vecs::CommandBuffer buffer2;
+
+  auto e_id = buffer1.spawn();
+
+  CHECK_THROWS( buffer2.add_components(e_id, TestType1{}) );
+  CHECK_THROWS( buffer2.remove_components<TestType1>(e_id) );
+  CHECK_THROWS( buffer2.despawn(e_id) );
+  CHECK( buffer2.empty() );
+
+  buffer1.flush(e_manager, c_manager);
+
+  CHECK_THROWS( buffer1.add_components(e_id, TestType1{}) );
+  CHECK( e_manager.count() == 1 );
+}
+
+TEST_CASE( "command_payload", "[commands][payload]" )
+{
+  struct TestType1
+  {
+    std::string name;
+  };
+
+  struct alignas(64) TestType2
+  {
+    double value = 0.0;
+  };
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::CommandBuffer buffer;
+
+  for (int i = 0; i < 200; ++i)
+  {
+    auto e_id = buffer.spawn();
+    buffer.add_components(e_id, TestType1{ std::string(64, static_cast<char>('a' + i % 26)) }, TestType2{ static_cast<double>(i) });
+  }
+
+  buffer.flush(e_manager, c_manager);
+
+  CHECK( e_manager.count() == 200 );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(0)).name == std::string(64, 'a') );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(199)).name == std::string(64, static_cast<char>('a' + 199 % 26)) );
+  CHECK( c_manager.get<TestType2>(vecs::Entity(199)).value == 199.0 );
+
+  buffer.add_components(vecs::Entity(0), TestType1{ "reused" });
+  buffer.flush(e_manager, c_manager);
+
+  CHECK( c_manager.get<TestType1>(vecs::Entity(0)).name == "reused" );
+}
+
+TEST_CASE( "command_queue", "[commands][queue]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::CommandQueue queue;
+  vecs::ThreadPool pool(4);
+
+  pool.parallel_for(100, [&queue](unsigned long i){
+    auto& buffer = queue.local();
+    auto e_id = buffer.spawn();
+    buffer.add_components(e_id, TestType1{ static_cast<int>(i) });
+  });
+
+  CHECK( queue.size() == 200 );
+  CHECK( &queue.local() == &queue.local() );
+
+  queue.flush(e_manager, c_manager);
+
+  CHECK( queue.size() == 0 );
+  CHECK( e_manager.count() == 100 );
+  CHECK( e_manager.retrieve<TestType1>().size() == 100 );
+
+  int total = 0;
+  for (const auto& e_id : e_manager.view<TestType1>())
+    total += c_manager.get<TestType1>(e_id).a;
+
+  CHECK( total == 4950 );
+}
\ No newline at end of file
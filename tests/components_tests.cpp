@@ -2,6 +2,32 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <cstdint>
+
+namespace TEST
+{
+
+struct Vec3
+{
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+};
+
+struct State
+{
+  double position = 0.0;
+  double velocity = 0.0;
+};
+
+} // namespace TEST
+
+template <>
+struct vecs::SoALayout<TEST::Vec3> : vecs::SoAFields<float, 3> {};
+
+template <>
+struct vecs::BufferLayout<TEST::State> : vecs::DoubleBuffered {};
+
 TEST_CASE( "array_emplace", "[components][arrayemplace]" )
 {
   struct TestType
@@ -11,9 +37,9 @@ TEST_CASE( "array_emplace", "[components][arrayemplace]" )
 
   TEST::ComponentArray<TestType> componentArray;
 
-  componentArray.emplace(1, { 3 });
+  componentArray.emplace(vecs::Entity(1), { 3 });
 
-  CHECK( componentArray.contains(1) );
+  CHECK( componentArray.contains(vecs::Entity(1)) );
 }
 
 TEST_CASE( "array_erase", "[components][arrayerase]" )
@@ -25,10 +51,10 @@ TEST_CASE( "array_erase", "[components][arrayerase]" )
 
   TEST::ComponentArray<TestType> componentArray;
 
-  componentArray.emplace(1, { 3 });
-  componentArray.erase(1);
+  componentArray.emplace(vecs::Entity(1), { 3 });
+  componentArray.erase(vecs::Entity(1));
 
-  CHECK( !componentArray.contains(1) );
+  CHECK( !componentArray.contains(vecs::Entity(1)) );
 }
 
 TEST_CASE( "array_at", "[components][arrayat]" )
@@ -40,9 +66,9 @@ TEST_CASE( "array_at", "[components][arrayat]" )
 
   TEST::ComponentArray<TestType> componentArray;
   
-  componentArray.emplace(1, { 3 });
+  componentArray.emplace(vecs::Entity(1), { 3 });
 
-  CHECK( componentArray.at(1).a == 3 );
+  CHECK( componentArray.at(vecs::Entity(1)).a == 3 );
 }
 
 TEST_CASE( "register", "[components][register]" )
@@ -110,11 +136,50 @@ TEST_CASE( "update_data", "[components][updatedata]" )
   TEST::ComponentManager manager;
 
   manager.register_components<TestType>();
-  manager.update_data<TestType>(0, { 3 });
+  manager.update_data<TestType>(vecs::Entity(0), { 3 });
 
   auto array = manager.component_array<TestType>();
 
-  CHECK( array->at(0).a == 3 );
+  CHECK( array->at(vecs::Entity(0)).a == 3 );
+}
+
+TEST_CASE( "update_data_bulk", "[components][updatedatabulk]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentManager manager;
+  std::vector<vecs::Entity> e_ids{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2), vecs::Entity(3) };
+
+  manager.register_components<TestType>();
+  manager.update_data<TestType>(vecs::Entity(0), { 7 });
+
+  SECTION( "spans" )
+  {
+    std::vector<TestType> data{ { 1 }, { 2 }, { 3 }, { 4 } };
+    manager.update_data<TestType>(std::vector<vecs::Entity>{ vecs::Entity(4), vecs::Entity(5) }, data);
+    manager.update_data<TestType>(e_ids, data);
+
+    auto array = manager.component_array<TestType>();
+
+    CHECK( array->size() == 6 );
+    for (int i = 0; i < 4; ++i)
+      CHECK( array->at(vecs::Entity(i)).a == i + 1 );
+    CHECK( array->at(vecs::Entity(5)).a == 2 );
+  }
+
+  SECTION( "generator" )
+  {
+    manager.generate_data<TestType>(e_ids, [](unsigned long i){ return TestType{ static_cast<int>(i * 10) }; });
+
+    auto array = manager.component_array<TestType>();
+
+    CHECK( array->size() == 4 );
+    CHECK( array->at(vecs::Entity(0)).a == 0 );
+    CHECK( array->at(vecs::Entity(3)).a == 30 );
+  }
 }
 
 TEST_CASE( "remove_data", "[components][removedata]" )
@@ -127,13 +192,56 @@ TEST_CASE( "remove_data", "[components][removedata]" )
   TEST::ComponentManager manager;
 
   manager.register_components<TestType>();
-  manager.update_data<TestType>(0, { 3 });
-  manager.remove_data<TestType>(0);
+  manager.update_data<TestType>(vecs::Entity(0), { 3 });
+  manager.remove_data<TestType>(vecs::Entity(0));
 
   auto vecs_array = manager.component_array<TestType>();
   TEST::ComponentArray array(*vecs_array);
 
-  CHECK( !array.contains(0) );
+  CHECK( !array.contains(vecs::Entity(0)) );
+}
+
+TEST_CASE( "remove_data_bulk", "[components][removedatabulk]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentManager manager;
+
+  manager.register_components<TestType>();
+  for (int i = 0; i < 4; ++i)
+    manager.update_data<TestType>(vecs::Entity(i), { i });
+
+  manager.remove_data<TestType>(std::set<vecs::Entity>{ vecs::Entity(1), vecs::Entity(2) });
+
+  TEST::ComponentArray array(*manager.component_array<TestType>());
+
+  CHECK( array.size() == 2 );
+  CHECK( array.at(vecs::Entity(0)).a == 0 );
+  CHECK( array.at(vecs::Entity(3)).a == 3 );
+}
+
+TEST_CASE( "stale_entity", "[components][staleentity]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentArray<TestType> componentArray;
+
+  componentArray.emplace(vecs::Entity(4, 0), { 3 });
+
+  CHECK( componentArray.contains(vecs::Entity(4, 0)) );
+  CHECK( !componentArray.contains(vecs::Entity(4, 1)) );
+
+  componentArray.emplace(vecs::Entity(4, 1), { 5 });
+
+  CHECK( !componentArray.contains(vecs::Entity(4, 0)) );
+  CHECK( componentArray.at(vecs::Entity(4, 1)).a == 5 );
+  CHECK( componentArray.size() == 1 );
 }
 
 TEST_CASE( "retrieve", "[components][retrieve]" )
@@ -146,10 +254,471 @@ TEST_CASE( "retrieve", "[components][retrieve]" )
   TEST::ComponentManager manager;
 
   manager.register_components<TestType>();
-  manager.update_data<TestType>(0, { 3 });
+  manager.update_data<TestType>(vecs::Entity(0), { 3 });
 
-  auto data = manager.retrieve<TestType>(0);
+  auto data = manager.retrieve<TestType>(vecs::Entity(0));
 
   REQUIRE( data != std::nullopt );
   CHECK( data.value().a == 3 );
+}
+
+TEST_CASE( "array_dense", "[components][arraydense]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentArray<TestType> componentArray;
+
+  componentArray.emplace(vecs::Entity(5), { 5 });
+  componentArray.emplace(vecs::Entity(70000), { 7 });
+  componentArray.emplace(vecs::Entity(2), { 2 });
+
+  SECTION( "lookup" )
+  {
+    CHECK( componentArray.size() == 3 );
+    CHECK( componentArray.at(vecs::Entity(70000)).a == 7 );
+    CHECK( !componentArray.contains(vecs::Entity(3)) );
+    CHECK( !componentArray.contains(vecs::Entity(100000)) );
+  }
+
+  SECTION( "iteration" )
+  {
+    int sum = 0;
+    for (const auto& component : componentArray.components())
+      sum += component.a;
+
+    CHECK( sum == 14 );
+    CHECK( componentArray.entities()[1] == vecs::Entity(70000) );
+  }
+
+  SECTION( "erase_keeps_index" )
+  {
+    componentArray.erase(vecs::Entity(5));
+
+    CHECK( componentArray.size() == 2 );
+    CHECK( componentArray.at(vecs::Entity(70000)).a == 7 );
+    CHECK( componentArray.at(vecs::Entity(2)).a == 2 );
+    CHECK( componentArray.entities()[0] == vecs::Entity(2) );
+  }
+
+  SECTION( "erase_last" )
+  {
+    componentArray.erase(vecs::Entity(2));
+
+    CHECK( componentArray.size() == 2 );
+    CHECK( componentArray.at(vecs::Entity(5)).a == 5 );
+    CHECK( componentArray.at(vecs::Entity(70000)).a == 7 );
+  }
+}
+
+TEST_CASE( "array_bulk_erase", "[components][arraybulkerase]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentArray<TestType> componentArray;
+
+  for (int i = 0; i < 10; ++i)
+    componentArray.emplace(vecs::Entity(i), { i });
+
+  componentArray.erase(std::vector<vecs::Entity>{ vecs::Entity(0), vecs::Entity(3), vecs::Entity(9), vecs::Entity(42) });
+
+  CHECK( componentArray.size() == 7 );
+  for (int i = 0; i < 10; ++i)
+  {
+    if (i == 0 || i == 3 || i == 9)
+      CHECK( !componentArray.contains(vecs::Entity(i)) );
+    else
+      CHECK( componentArray.at(vecs::Entity(i)).a == i );
+  }
+}
+
+TEST_CASE( "get", "[components][get]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    int b = 1;
+  };
+
+  TEST::ComponentManager manager;
+
+  manager.register_components<TestType1>();
+  manager.update_data<TestType1>(vecs::Entity(0), { 3 });
+
+  SECTION( "mutate_in_place" )
+  {
+    manager.get<TestType1>(vecs::Entity(0)).a += 4;
+
+    CHECK( manager.retrieve<TestType1>(vecs::Entity(0)).value().a == 7 );
+  }
+
+  SECTION( "const_access" )
+  {
+    const auto& c_manager = manager;
+
+    CHECK( c_manager.get<TestType1>(vecs::Entity(0)).a == 3 );
+    CHECK( c_manager.try_get<TestType1>(vecs::Entity(1)) == nullptr );
+  }
+
+  SECTION( "missing" )
+  {
+    CHECK_THROWS( manager.get<TestType1>(vecs::Entity(1)) );
+    CHECK_THROWS( manager.get<TestType2>(vecs::Entity(0)) );
+  }
+}
+
+TEST_CASE( "try_get", "[components][tryget]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    int b = 1;
+  };
+
+  TEST::ComponentManager manager;
+
+  manager.register_components<TestType1>();
+  manager.update_data<TestType1>(vecs::Entity(0), { 3 });
+
+  auto * data = manager.try_get<TestType1>(vecs::Entity(0));
+
+  REQUIRE( data != nullptr );
+  data->a = 5;
+
+  CHECK( manager.get<TestType1>(vecs::Entity(0)).a == 5 );
+  CHECK( manager.try_get<TestType1>(vecs::Entity(0, 1)) == nullptr );
+  CHECK( manager.try_get<TestType2>(vecs::Entity(0)) == nullptr );
+}
+
+TEST_CASE( "array_chunks", "[components][arraychunks]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentManager manager;
+
+  manager.register_components<TestType>();
+  auto array = manager.component_array<TestType>();
+
+  manager.update_data<TestType>(vecs::Entity(0), { 0 });
+  TestType * p_first = manager.try_get<TestType>(vecs::Entity(0));
+
+  std::vector<vecs::Entity> e_ids;
+  for (unsigned long i = 1; i <= 3 * vecs::ChunkedArray<TestType>::chunk_elements; ++i)
+    e_ids.emplace_back(i);
+
+  manager.generate_data<TestType>(e_ids, [](unsigned long){ return TestType{ 1 }; });
+
+  CHECK( manager.try_get<TestType>(vecs::Entity(0)) == p_first );
+  CHECK( array->chunk_count() == 4 );
+
+  int total = 0;
+  for (unsigned long i = 0; i < array->chunk_count(); ++i)
+  {
+    for (const auto& component : array->chunk(i))
+      total += component.a;
+  }
+
+  CHECK( total == static_cast<int>(e_ids.size()) );
+
+  manager.remove_data<TestType>(e_ids);
+  manager.trim();
+
+  CHECK( array->size() == 1 );
+  CHECK( array->chunk_count() == 1 );
+}
+
+TEST_CASE( "soa_array", "[components][soaarray]" )
+{
+  vecs::SoAComponentArray<TEST::Vec3> array;
+
+  for (unsigned long i = 0; i < 5; ++i)
+    array.emplace(vecs::Entity(i), { 1.0f * i, 2.0f * i, 3.0f * i });
+
+  REQUIRE( array.size() == 5 );
+
+  for (unsigned long field = 0; field < 3; ++field)
+    CHECK( reinterpret_cast<std::uintptr_t>(array.column(field).data()) % array.alignment == 0 );
+
+  CHECK( array.column(1)[4] == 8.0f );
+  CHECK( array.at(vecs::Entity(2)).z == 6.0f );
+
+  SECTION( "erase" )
+  {
+    array.erase(vecs::Entity(1));
+
+    CHECK( array.size() == 4 );
+    CHECK( !array.contains(vecs::Entity(1)) );
+    CHECK( array.entities()[1] == vecs::Entity(4) );
+    CHECK( array.at(vecs::Entity(4)).y == 8.0f );
+  }
+
+  SECTION( "overwrite" )
+  {
+    array.emplace(vecs::Entity(3), { 9.0f, 9.0f, 9.0f });
+
+    CHECK( array.size() == 5 );
+    CHECK( array.column(0)[3] == 9.0f );
+  }
+
+  SECTION( "invalid" )
+  {
+    CHECK_THROWS( array.at(vecs::Entity(7)) );
+  }
+}
+
+TEST_CASE( "soa_columns", "[components][soacolumns]" )
+{
+  TEST::ComponentManager manager;
+  std::vector<vecs::Entity> e_ids{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2), vecs::Entity(3) };
+  std::vector<TEST::Vec3> positions{ { 0, 0, 0 }, { 1, 1, 1 }, { 2, 2, 2 }, { 3, 3, 3 } };
+
+  manager.register_components<TEST::Vec3>();
+  manager.update_data<TEST::Vec3>(e_ids, positions);
+
+  auto * columns = manager.columns<TEST::Vec3>();
+  REQUIRE( columns != nullptr );
+
+  for (unsigned long field = 0; field < 3; ++field)
+  {
+    auto column = columns->column(field);
+    for (unsigned long i = 0; i < column.size(); ++i)
+      column[i] += 0.5f;
+  }
+
+  CHECK( manager.retrieve<TEST::Vec3>(vecs::Entity(2)).value().y == 2.5f );
+
+  SECTION( "remove" )
+  {
+    manager.remove_data<TEST::Vec3>(vecs::Entity(2));
+
+    CHECK( columns->size() == 3 );
+    CHECK( !columns->contains(vecs::Entity(2)) );
+  }
+}
+
+TEST_CASE( "components_memory_resource", "[components][memoryresource]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::CountingResource resource;
+
+  {
+    TEST::ComponentManager manager(&resource);
+
+    manager.register_components<TestType, TEST::Vec3>();
+    for (unsigned long i = 0; i < 10; ++i)
+      manager.update_data(vecs::Entity(i), TestType{}, TEST::Vec3{});
+
+    CHECK( resource.allocations > 0 );
+    CHECK( resource.bytes >= vecs::ChunkPool::chunk_size );
+
+    manager.remove_data<TestType>(std::vector<vecs::Entity>{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2) });
+    manager.trim();
+  }
+
+  CHECK( resource.bytes == 0 );
+}
+
+TEST_CASE( "change_ticks", "[components][changeticks]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentManager manager;
+
+  manager.register_components<TestType>();
+  for (int i = 0; i < 4; ++i)
+    manager.update_data<TestType>(vecs::Entity(i), { i });
+
+  std::uint32_t since = manager.tick();
+  CHECK( manager.advance_tick() == since + 1 );
+  CHECK( manager.added<TestType>(vecs::Entity(0), since - 1) );
+  CHECK( !manager.added<TestType>(vecs::Entity(0), since) );
+  CHECK( !manager.changed<TestType>(vecs::Entity(0), since) );
+  CHECK( !manager.changed<TestType>(vecs::Entity(9), 0) );
+
+  manager.update_data<TestType>(vecs::Entity(1), { 5 });
+  manager.get<TestType>(vecs::Entity(2)).a = 6;
+  CHECK( std::as_const(manager).get<TestType>(vecs::Entity(3)).a == 3 );
+
+  CHECK( manager.changed<TestType>(vecs::Entity(1), since) );
+  CHECK( manager.changed<TestType>(vecs::Entity(2), since) );
+  CHECK( !manager.changed<TestType>(vecs::Entity(3), since) );
+  CHECK( !manager.added<TestType>(vecs::Entity(1), since) );
+
+  std::vector<vecs::Entity> e_ids{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2), vecs::Entity(3) };
+  std::vector<vecs::Entity> changed;
+  for (vecs::Entity e_id : manager.filter(e_ids, vecs::Changed<TestType>{ since }))
+    changed.emplace_back(e_id);
+
+  CHECK( changed == std::vector<vecs::Entity>{ vecs::Entity(1), vecs::Entity(2) } );
+
+  manager.update_data<TestType>(vecs::Entity(4), { 4 });
+  manager.remove_data<TestType>(vecs::Entity(0));
+
+  changed.clear();
+  e_ids.emplace_back(4);
+  for (vecs::Entity e_id : manager.filter(e_ids, vecs::Added<TestType>{ since }, vecs::Changed<TestType>{ since }))
+    changed.emplace_back(e_id);
+
+  CHECK( changed == std::vector<vecs::Entity>{ vecs::Entity(4) } );
+  CHECK( manager.changed<TestType>(vecs::Entity(3), 0) );
+}
+
+TEST_CASE( "change_ticks_access", "[components][changeticksaccess]" )
+{
+  struct TestType
+  {
+    int a = 1;
+  };
+
+  TEST::ComponentManager manager;
+  std::vector<vecs::Entity> e_ids{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2), vecs::Entity(3) };
+  std::vector<TEST::Vec3> positions{ { 0, 0, 0 }, { 1, 1, 1 }, { 2, 2, 2 }, { 3, 3, 3 } };
+
+  manager.register_components<TestType, TEST::Vec3>();
+  manager.update_data<TEST::Vec3>(e_ids, positions);
+  for (int i = 0; i < 4; ++i)
+    manager.update_data<TestType>(vecs::Entity(i), { i });
+
+  std::uint32_t since = manager.advance_tick() - 1;
+
+  CHECK( std::as_const(manager).try_get<TestType>(vecs::Entity(1))->a == 1 );
+  CHECK( std::as_const(manager).columns<TEST::Vec3>()->column(0)[1] == 1.0f );
+  CHECK( std::as_const(*manager.columns<TEST::Vec3>()).at(vecs::Entity(2)).y == 2.0f );
+  CHECK( !manager.changed<TestType>(vecs::Entity(1), since) );
+  CHECK( !manager.changed<TEST::Vec3>(vecs::Entity(1), since) );
+
+  SECTION( "soa_column" )
+  {
+    manager.columns<TEST::Vec3>()->column(1)[2] = 5.0f;
+
+    CHECK( manager.retrieve<TEST::Vec3>(vecs::Entity(2)).value().y == 5.0f );
+    CHECK( manager.changed<TEST::Vec3>(vecs::Entity(2), since) );
+    CHECK( manager.changed<TEST::Vec3>(vecs::Entity(0), since) );
+  }
+
+  SECTION( "soa_mark" )
+  {
+    manager.columns<TEST::Vec3>()->mark(vecs::Entity(3));
+
+    CHECK( manager.changed<TEST::Vec3>(vecs::Entity(3), since) );
+    CHECK( !manager.changed<TEST::Vec3>(vecs::Entity(2), since) );
+  }
+
+  SECTION( "array" )
+  {
+    manager.try_get<TestType>(vecs::Entity(2))->a = 7;
+
+    CHECK( manager.changed<TestType>(vecs::Entity(2), since) );
+    CHECK( !manager.changed<TestType>(vecs::Entity(3), since) );
+  }
+}
+
+TEST_CASE( "double_buffers", "[components][doublebuffers]" )
+{
+  TEST::ComponentManager manager;
+
+  manager.register_components<TEST::State>();
+  for (unsigned long i = 0; i < 4; ++i)
+    manager.update_data(vecs::Entity(i), TEST::State{ static_cast<double>(i), 1.0 });
+
+  auto * buffers = manager.buffers<TEST::State>();
+  REQUIRE( buffers != nullptr );
+  CHECK( buffers->size() == 4 );
+
+  std::uint32_t since = manager.advance_tick();
+  for (vecs::Entity e_id : buffers->entities())
+  {
+    const auto& previous = manager.front<TEST::State>(e_id);
+    manager.back<TEST::State>(e_id) = TEST::State{ previous.position + previous.velocity * 0.5, previous.velocity };
+  }
+
+  CHECK( manager.front<TEST::State>(vecs::Entity(2)).position == 2.0 );
+  CHECK( manager.changed<TEST::State>(vecs::Entity(2), since - 1) );
+
+  manager.swap_buffers<TEST::State>();
+
+  CHECK( manager.front<TEST::State>(vecs::Entity(2)).position == 2.5 );
+  CHECK( manager.retrieve<TEST::State>(vecs::Entity(3)).value().position == 3.5 );
+  CHECK( buffers->back(vecs::Entity(2)).position == 2.5 );
+
+  manager.swap_buffers();
+
+  CHECK( manager.front<TEST::State>(vecs::Entity(2)).position == 2.5 );
+  CHECK_THROWS( manager.back<TEST::State>(vecs::Entity(9)) );
+
+  SECTION( "erase" )
+  {
+    manager.remove_data<TEST::State>(vecs::Entity(0));
+
+    CHECK( buffers->size() == 3 );
+    CHECK( !buffers->contains(vecs::Entity(0)) );
+    CHECK( buffers->at(vecs::Entity(3)).position == 3.5 );
+    CHECK( buffers->back(vecs::Entity(3)).position == 3.5 );
+  }
+
+  SECTION( "partial_writes" )
+  {
+    for (int frame = 0; frame < 2; ++frame)
+    {
+      manager.back<TEST::State>(vecs::Entity(1)).position += 1.0;
+      manager.swap_buffers();
+    }
+
+    CHECK( manager.front<TEST::State>(vecs::Entity(1)).position == 3.5 );
+    CHECK( manager.front<TEST::State>(vecs::Entity(2)).position == 2.5 );
+    CHECK( buffers->back(vecs::Entity(1)).position == 3.5 );
+    CHECK( buffers->back(vecs::Entity(2)).position == 2.5 );
+  }
+
+  SECTION( "back_chunk" )
+  {
+    std::span<TEST::State> back = buffers->back_chunk(0);
+    back[3].position = 9.0;
+    manager.swap_buffers();
+    manager.swap_buffers();
+
+    CHECK( manager.front<TEST::State>(vecs::Entity(3)).position == 9.0 );
+    CHECK( manager.front<TEST::State>(vecs::Entity(2)).position == 2.5 );
+  }
+
+  SECTION( "erase_between_swaps" )
+  {
+    vecs::Entity last(vecs::ChunkedArray<TEST::State>::chunk_elements + 4);
+    for (unsigned long i = 4; i <= last.index(); ++i)
+      manager.update_data(vecs::Entity(i), TEST::State{ static_cast<double>(i), 1.0 });
+
+    manager.back<TEST::State>(last).position = 42.0;
+    manager.remove_data<TEST::State>(vecs::Entity(0));
+    manager.swap_buffers();
+
+    CHECK( manager.front<TEST::State>(last).position == 42.0 );
+
+    manager.swap_buffers();
+
+    CHECK( manager.front<TEST::State>(last).position == 42.0 );
+    CHECK( buffers->back(last).position == 42.0 );
+  }
 }
\ No newline at end of file
@@ -2,20 +2,23 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <array>
+
 TEST_CASE( "valid", "[entities][valid]" )
 {
   TEST::EntityManager manager;
 
   SECTION( "invalid_entity" )
   {
-    CHECK( !manager.valid(0) );
+    CHECK( !manager.valid(vecs::Entity(0)) );
   }
 
   SECTION( "valid_entity" )
   {
     manager.new_entity();
 
-    CHECK( manager.valid(0) );
+    CHECK( manager.valid(vecs::Entity(0)) );
   }
 }
 
@@ -24,17 +27,87 @@ TEST_CASE( "new_entity", "[entities][new]" )
   TEST::EntityManager manager;
 
   for (unsigned long i = 0; i < 5; ++i)
-    manager.new_entity();
+    CHECK( manager.new_entity() == vecs::Entity(i, 0) );
 
   CHECK( manager.count() == 5 );
-  CHECK( manager.stack_top() == 5);
+  CHECK( manager.free_list().empty() );
 
   for ( unsigned long i = 0; i < 5; ++i)
-    CHECK( manager.valid(i) );
+    CHECK( manager.valid(vecs::Entity(i)) );
+}
+
+TEST_CASE( "create_entities", "[entities][create]" )
+{
+  struct TestType
+  {
+    int a = 0;
+  };
+
+  TEST::EntityManager manager;
+
+  manager.new_entity();
+  manager.new_entity();
+  manager.remove_entity(vecs::Entity(0));
+
+  auto query = manager.register_query<TestType>();
+  auto created = manager.create_entities<TestType>(4);
+
+  REQUIRE( created.size() == 4 );
+  CHECK( created[0] == vecs::Entity(0, 1) );
+  CHECK( created[1] == vecs::Entity(2, 0) );
+  CHECK( created[3] == vecs::Entity(4, 0) );
+  CHECK( manager.count() == 5 );
+  CHECK( manager.free_list().empty() );
+  CHECK( manager.retrieve<TestType>() == std::set<vecs::Entity>(created.begin(), created.end()) );
+  CHECK( query->size() == 4 );
+
+  SECTION( "limit" )
+  {
+    VECS_SETTINGS.update_max_entities(7);
+
+    CHECK( manager.create_entities(4).size() == 2 );
+    CHECK( manager.count() == 7 );
+    CHECK( manager.create_entities(1).empty() );
+
+    VECS_SETTINGS.set_default();
+  }
+}
+
+TEST_CASE( "entity_capacity", "[entities][capacity]" )
+{
+  struct TestType
+  {
+    int a = 0;
+  };
+
+  TEST::EntityManager e_manager;
+  TEST::ComponentManager c_manager;
+
+  VECS_SETTINGS.update_max_entities(100000);
+  c_manager.register_components<TestType>();
+
+  auto created = e_manager.create_entities<TestType>(70000);
+  c_manager.generate_data<TestType>(created, [](unsigned long i){ return TestType{ static_cast<int>(i) }; });
+
+  REQUIRE( created.size() == 70000 );
+  CHECK( e_manager.count() == 70000 );
+  CHECK( created.back() == vecs::Entity(69999) );
+  CHECK( e_manager.valid(created.back()) );
+  CHECK( c_manager.get<TestType>(created.back()).a == 69999 );
+
+  auto e_id = e_manager.new_entity();
+  CHECK( e_id.index() == 70000 );
+
+  VECS_SETTINGS.set_default();
 }
 
 TEST_CASE( "remove_entity", "[entities][remove]" )
 {
+  struct TestType
+  {
+    int a = 0;
+  };
+
   TEST::EntityManager manager;
 
   for (unsigned long i = 0; i < 5; ++i)
@@ -42,55 +115,76 @@ TEST_CASE( "remove_entity", "[entities][remove]" )
   
   SECTION( "removal" )
   {
-    manager.remove_entity(2);
+    manager.remove_entity(vecs::Entity(2));
     
     CHECK( manager.count() == 4 );
-    CHECK( manager.stack_top() == 2 );
-    CHECK( !manager.valid(2) );
+    CHECK( manager.free_list().back() == 2 );
+    CHECK( !manager.valid(vecs::Entity(2)) );
+  }
+
+  SECTION( "swap_last" )
+  {
+    manager.add_components<TestType>(vecs::Entity(4));
+    manager.remove_entity(vecs::Entity(1));
+
+    CHECK( manager.index_of(vecs::Entity(4)) == 1 );
+    CHECK( manager.id_of(1) == vecs::Entity(4, 0) );
+    CHECK( manager.has_component<TestType>(vecs::Entity(4)) );
+    CHECK( manager.retrieve<TestType>() == std::set<vecs::Entity>{ vecs::Entity(4) } );
   }
 
   SECTION ( "addition_after_removal" )
   {
-    manager.remove_entity(2);
-    manager.new_entity();
+    manager.remove_entity(vecs::Entity(2));
+    auto entity = manager.new_entity();
     
     CHECK( manager.count() == 5 );
-    CHECK( manager.stack_top() == 5 );
-    CHECK( manager.valid(2) );
+    CHECK( manager.free_list().empty() );
+    CHECK( entity == vecs::Entity(2, 1) );
+    CHECK( manager.valid(entity) );
+    CHECK( !manager.valid(vecs::Entity(2)) );
+  }
+
+  SECTION ( "stale_removal" )
+  {
+    manager.remove_entity(vecs::Entity(2));
+    manager.new_entity();
+    manager.remove_entity(vecs::Entity(2));
+
+    CHECK( manager.count() == 5 );
+    CHECK( manager.valid(vecs::Entity(2, 1)) );
   }
 
   SECTION ( "remove_all" )
   {
     for (unsigned long i = 0; i < 5; ++i)
-      manager.remove_entity(i);
+      manager.remove_entity(vecs::Entity(i));
     
     CHECK( manager.count() == 0 );
-    CHECK( manager.stack_top() == 0 );
+    CHECK( manager.free_list().size() == 5 );
     
     for(unsigned long i = 0; i < 5; ++i)
-      CHECK( !manager.valid(i) );
+      CHECK( !manager.valid(vecs::Entity(i)) );
   }
 }
 
-TEST_CASE( "nextID", "[entities][nextid]" )
+TEST_CASE( "free_list", "[entities][freelist]" )
 {
-  std::stack<unsigned long> testStack;
   TEST::EntityManager manager;
 
   for (unsigned long i = 0; i < 5; ++i)
     manager.new_entity();
 
-  manager.remove_entity(1);
-  manager.remove_entity(2);
-  manager.remove_entity(3);
-  
-  for (unsigned long i = 5; i > 0; --i)
-  {
-    if (i == 4) continue;
-    testStack.emplace(i);
-  }
+  manager.remove_entity(vecs::Entity(1));
+  manager.remove_entity(vecs::Entity(2));
+  manager.remove_entity(vecs::Entity(3));
   
-  CHECK( manager.stack() == testStack );
+  CHECK( manager.free_list() == std::vector<vecs::EntityIndex>{ 1, 2, 3 } );
+
+  CHECK( manager.new_entity() == vecs::Entity(3, 1) );
+  CHECK( manager.new_entity() == vecs::Entity(2, 1) );
+  CHECK( manager.new_entity() == vecs::Entity(1, 1) );
+  CHECK( manager.new_entity() == vecs::Entity(5, 0) );
 }
 
 TEST_CASE( "add_component", "[entities][addcomponent]" )
@@ -109,10 +203,10 @@ TEST_CASE( "add_component", "[entities][addcomponent]" )
   TEST::EntityManager manager;
 
   manager.new_entity();
-  manager.add_components<TestType1, TestType2>(0);
+  manager.add_components<TestType1, TestType2>(vecs::Entity(0));
 
-  CHECK( manager.has_component<TestType1>(0) );
-  CHECK( manager.has_component<TestType2>(0) );
+  CHECK( manager.has_component<TestType1>(vecs::Entity(0)) );
+  CHECK( manager.has_component<TestType2>(vecs::Entity(0)) );
 }
 
 TEST_CASE( "remove_component", "[entities][removecomponent]" )
@@ -130,11 +224,11 @@ TEST_CASE( "remove_component", "[entities][removecomponent]" )
   TEST::EntityManager manager;
 
   manager.new_entity();
-  manager.add_components<TestType1, TestType2>(0);
-  manager.remove_components<TestType1, TestType2>(0);
+  manager.add_components<TestType1, TestType2>(vecs::Entity(0));
+  manager.remove_components<TestType1, TestType2>(vecs::Entity(0));
 
-  CHECK( !manager.has_component<TestType1>(0) );
-  CHECK( !manager.has_component<TestType2>(0) );
+  CHECK( !manager.has_component<TestType1>(vecs::Entity(0)) );
+  CHECK( !manager.has_component<TestType2>(vecs::Entity(0)) );
 }
 
 TEST_CASE( "find_index", "[entities][findindex]" )
@@ -146,15 +240,15 @@ TEST_CASE( "find_index", "[entities][findindex]" )
     manager.new_entity();
     manager.new_entity();
 
-    CHECK( manager.index_of(0) == 0 );
-    CHECK( manager.index_of(1) == 1 );
+    CHECK( manager.index_of(vecs::Entity(0)) == 0 );
+    CHECK( manager.index_of(vecs::Entity(1)) == 1 );
   }
 
   SECTION( "self_comparison" )
   {
     manager.new_entity();
 
-    CHECK( manager.index_of(0) == manager.index_of(0) );
+    CHECK( manager.index_of(vecs::Entity(0)) == manager.index_of(vecs::Entity(0)) );
   } 
 }
 
@@ -167,8 +261,8 @@ TEST_CASE( "find_id", "[entities][findid]" )
     manager.new_entity();
     manager.new_entity();
 
-    CHECK( manager.id_of(0) == 0 );
-    CHECK( manager.id_of(1) == 1);
+    CHECK( manager.id_of(0) == vecs::Entity(0) );
+    CHECK( manager.id_of(1) == vecs::Entity(1));
   }
 
   SECTION( "self_comparison" )
@@ -198,7 +292,7 @@ TEST_CASE( "retrieval", "[entities][retrieval]" )
 
   SECTION( "empty_retrieval" )
   {
-    std::set<unsigned long> testSet{ 0, 1, 2, 3, 4 };
+    std::set<vecs::Entity> testSet{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2), vecs::Entity(3), vecs::Entity(4) };
     
     auto nonexact = manager.retrieve<>();
     auto exact = manager.retrieve<>(true);
@@ -210,25 +304,58 @@ TEST_CASE( "retrieval", "[entities][retrieval]" )
   SECTION( "retrieve_all" )
   {    
     for (unsigned long i = 0; i < 3; ++i)
-      manager.add_components<TestType1>(i);
+      manager.add_components<TestType1>(vecs::Entity(i));
 
-    manager.add_components<TestType2>(3);
-    manager.add_components<TestType1, TestType2>(4);
+    manager.add_components<TestType2>(vecs::Entity(3));
+    manager.add_components<TestType1, TestType2>(vecs::Entity(4));
 
-    CHECK( manager.retrieve<TestType1>() == std::set<unsigned long>{ 0, 1, 2, 4 } );
-    CHECK( manager.retrieve<TestType2>() == std::set<unsigned long>{ 3, 4 } );
-    CHECK( manager.retrieve<TestType1, TestType2>() == std::set<unsigned long>{ 4 } );
+    CHECK( manager.retrieve<TestType1>() == std::set<vecs::Entity>{ vecs::Entity(0), vecs::Entity(1), vecs::Entity(2), vecs::Entity(4) } );
+    CHECK( manager.retrieve<TestType2>() == std::set<vecs::Entity>{ vecs::Entity(3), vecs::Entity(4) } );
+    CHECK( manager.retrieve<TestType1, TestType2>() == std::set<vecs::Entity>{ vecs::Entity(4) } );
   }
 
   SECTION( "retrieve_exact" )
   {
     for (unsigned long i = 0; i < 3; ++i)
-      manager.add_components<TestType1, TestType2>(i);
-    manager.add_components<TestType1>(3);
-    manager.add_components<TestType2>(4);
+      manager.add_components<TestType1, TestType2>(vecs::Entity(i));
+    manager.add_components<TestType1>(vecs::Entity(3));
+    manager.add_components<TestType2>(vecs::Entity(4));
 
-    CHECK( manager.retrieve<TestType1>(true) == std::set<unsigned long>{3} );
-    CHECK( manager.retrieve<TestType2>(true) == std::set<unsigned long>{4} );
-    CHECK( manager.retrieve<TestType1, TestType2>(true) == std::set<unsigned long>{0, 1, 2} );
+    CHECK( manager.retrieve<TestType1>(true) == std::set<vecs::Entity>{vecs::Entity(3)} );
+    CHECK( manager.retrieve<TestType2>(true) == std::set<vecs::Entity>{vecs::Entity(4)} );
+    CHECK( manager.retrieve<TestType1, TestType2>(true) == std::set<vecs::Entity>{vecs::Entity(0), vecs::Entity(1), vecs::Entity(2)} );
   }
+}
+
+TEST_CASE( "entities_memory_resource", "[entities][memoryresource]" )
+{
+  struct TestType
+  {
+    int a = 0;
+  };
+
+  TEST::CountingResource resource;
+
+  {
+    TEST::EntityManager manager(&resource);
+
+    for (unsigned long i = 0; i < 10; ++i)
+      manager.add_components<TestType>(manager.new_entity());
+
+    CHECK( resource.allocations > 0 );
+
+    SECTION( "retrieve" )
+    {
+      std::array<std::byte, 4096> buffer;
+      std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), std::pmr::null_memory_resource());
+
+      auto matches = manager.retrieve<TestType>(&arena);
+      auto view = manager.view<TestType>();
+
+      CHECK( matches.size() == 10 );
+      CHECK( std::ranges::equal(matches, view) );
+    }
+  }
+
+  CHECK( resource.bytes == 0 );
 }
\ No newline at end of file
@@ -0,0 +1,203 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+
+TEST_CASE( "query_register", "[queries][register]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  TEST::EntityManager manager;
+
+  for (unsigned long i = 0; i < 4; ++i)
+    manager.new_entity();
+
+  manager.add_components<TestType1>(vecs::Entity(0));
+  manager.add_components<TestType1, TestType2>(vecs::Entity(1));
+
+  auto query = manager.register_query<TestType1>();
+
+  SECTION( "populated" )
+  {
+    CHECK( query->size() == 2 );
+    CHECK( query->contains(vecs::Entity(0)) );
+    CHECK( query->contains(vecs::Entity(1)) );
+  }
+
+  SECTION( "shared" )
+  {
+    CHECK( manager.register_query<TestType1>() == query );
+    CHECK( manager.register_query<TestType1>(true) != query );
+  }
+
+  SECTION( "exact" )
+  {
+    auto exact = manager.register_query<TestType1>(true);
+
+    CHECK( exact->size() == 1 );
+    CHECK( exact->contains(vecs::Entity(0)) );
+  }
+}
+
+TEST_CASE( "query_update", "[queries][update]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  TEST::EntityManager manager;
+
+  auto all = manager.register_query<>();
+  auto query = manager.register_query<TestType1, TestType2>();
+
+  for (unsigned long i = 0; i < 4; ++i)
+    manager.new_entity();
+
+  CHECK( all->size() == 4 );
+  CHECK( query->size() == 0 );
+
+  SECTION( "add_components" )
+  {
+    manager.add_components<TestType1>(vecs::Entity(2));
+    CHECK( query->size() == 0 );
+
+    manager.add_components<TestType2>(vecs::Entity(2));
+    CHECK( query->size() == 1 );
+    CHECK( query->contains(vecs::Entity(2)) );
+  }
+
+  SECTION( "remove_components" )
+  {
+    manager.add_components<TestType1, TestType2>(vecs::Entity(2));
+    manager.add_components<TestType1, TestType2>(vecs::Entity(3));
+    manager.remove_components<TestType2>(vecs::Entity(2));
+
+    CHECK( query->size() == 1 );
+    CHECK( !query->contains(vecs::Entity(2)) );
+    CHECK( query->contains(vecs::Entity(3)) );
+  }
+
+  SECTION( "remove_entity" )
+  {
+    manager.add_components<TestType1, TestType2>(vecs::Entity(1));
+    manager.remove_entity(vecs::Entity(1));
+
+    CHECK( all->size() == 3 );
+    CHECK( query->size() == 0 );
+    CHECK( !all->contains(vecs::Entity(1)) );
+  }
+
+  SECTION( "iteration" )
+  {
+    manager.add_components<TestType1, TestType2>(vecs::Entity(0));
+    manager.add_components<TestType1, TestType2>(vecs::Entity(3));
+
+    std::vector<vecs::Entity> entities(query->begin(), query->end());
+    std::sort(entities.begin(), entities.end());
+
+    CHECK( entities == std::vector<vecs::Entity>{ vecs::Entity(0), vecs::Entity(3) } );
+  }
+
+  SECTION( "unregister" )
+  {
+    manager.unregister_query(query);
+    manager.add_components<TestType1, TestType2>(vecs::Entity(0));
+
+    CHECK( query->size() == 0 );
+  }
+
+  SECTION( "shared_unregister" )
+  {
+    auto other = manager.register_query<TestType1, TestType2>();
+    REQUIRE( other == query );
+
+    manager.unregister_query(other);
+    manager.add_components<TestType1, TestType2>(vecs::Entity(0));
+
+    CHECK( query->contains(vecs::Entity(0)) );
+
+    manager.unregister_query(query);
+    manager.add_components<TestType1, TestType2>(vecs::Entity(3));
+
+    CHECK( !query->contains(vecs::Entity(3)) );
+  }
+}
+
+TEST_CASE( "view", "[queries][view]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  struct TestType2
+  {
+    int b = 0;
+  };
+
+  TEST::EntityManager manager;
+
+  for (unsigned long i = 0; i < 6; ++i)
+    manager.new_entity();
+
+  for (unsigned long i = 0; i < 6; i += 2)
+    manager.add_components<TestType1>(vecs::Entity(i));
+  manager.add_components<TestType2>(vecs::Entity(4));
+
+  SECTION( "filtered" )
+  {
+    std::vector<vecs::Entity> entities;
+    for (const auto& e_id : manager.view<TestType1>())
+      entities.emplace_back(e_id);
+
+    CHECK( entities == std::vector<vecs::Entity>{ vecs::Entity(0), vecs::Entity(2), vecs::Entity(4) } );
+  }
+
+  SECTION( "exact" )
+  {
+    auto view = manager.view<TestType1>(true);
+
+    CHECK( std::vector<vecs::Entity>(view.begin(), view.end()) == std::vector<vecs::Entity>{ vecs::Entity(0), vecs::Entity(2) } );
+  }
+
+  SECTION( "empty" )
+  {
+    struct TestType3
+    {
+      int c = 0;
+    };
+
+    CHECK( manager.view<TestType3>().empty() );
+    CHECK( !manager.view<>().empty() );
+  }
+
+  SECTION( "matches_retrieve" )
+  {
+    auto view = manager.view<TestType1, TestType2>();
+
+    CHECK( std::set<vecs::Entity>(view.begin(), view.end()) == manager.retrieve<TestType1, TestType2>() );
+  }
+
+  SECTION( "query_view" )
+  {
+    auto query = manager.register_query<TestType1>();
+    auto view = query->view();
+
+    CHECK( std::distance(view.begin(), view.end()) == 3 );
+  }
+}
\ No newline at end of file
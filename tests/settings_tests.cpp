@@ -3,6 +3,7 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <stdexcept>
 #include <string>
 
 TEST_CASE( "component_id", "[settings][name]" )
@@ -17,15 +18,14 @@ TEST_CASE( "component_id", "[settings][name]" )
     int b = 0;
   };
 
-  vecs::Settings::destroy();
-
   SECTION( "unique" )
   {
     auto id1 = VECS_SETTINGS.component_id<TestType1>();
     auto id2 = VECS_SETTINGS.component_id<TestType2>();
 
-    CHECK( id1 == 0 );
-    CHECK( id2 == 1 );
+    CHECK( id1 != id2 );
+    CHECK( id1 < VECS_SETTINGS.max_components() );
+    CHECK( id2 < VECS_SETTINGS.max_components() );
   }
 
   SECTION( "shared" )
@@ -37,6 +37,26 @@ TEST_CASE( "component_id", "[settings][name]" )
   }
 }
 
+TEST_CASE( "system_id", "[settings][systemid]" )
+{
+  struct TestType1 {};
+  struct TestType2 {};
+
+  SECTION( "unique" )
+  {
+    CHECK( vecs::Settings::system_id<TestType1>() != vecs::Settings::system_id<TestType2>() );
+  }
+
+  SECTION( "stable" )
+  {
+    auto id = vecs::Settings::system_id<TestType1>();
+
+    vecs::Settings::destroy();
+
+    CHECK( vecs::Settings::system_id<TestType1>() == id );
+  }
+}
+
 TEST_CASE( "update_name", "[settings][name]" )
 {
   std::string testName = "test_name";
@@ -93,6 +113,25 @@ TEST_CASE( "toggle_portability", "[settings][portability]" )
   CHECK( VECS_SETTINGS.portability_enabled() != previous );
 }
 
+TEST_CASE( "toggle_headless", "[settings][headless]" )
+{
+  bool previous = VECS_SETTINGS.headless_enabled();
+  VECS_SETTINGS.toggle_headless();
+
+  CHECK( VECS_SETTINGS.headless_enabled() != previous );
+  CHECK( VECS_SETTINGS.device_extensions().empty() == VECS_SETTINGS.headless_enabled() );
+
+  VECS_SETTINGS.toggle_headless();
+}
+
+TEST_CASE( "toggle_compute", "[settings][compute]" )
+{
+  bool previous = VECS_SETTINGS.compute_enabled();
+  VECS_SETTINGS.toggle_compute();
+
+  CHECK( VECS_SETTINGS.compute_enabled() != previous );
+}
+
 TEST_CASE( "extensions", "[settings][extensions]" )
 {
   SECTION( "retrieve_extensions" )
@@ -187,14 +226,68 @@ TEST_CASE( "update_entities", "[settings][entities]" )
   VECS_SETTINGS.update_max_entities(testEntities);
 
   CHECK( VECS_SETTINGS.max_entities() == testEntities );
+
+  VECS_SETTINGS.update_max_entities(5000000);
+
+  CHECK( VECS_SETTINGS.max_entities() == 5000000 );
 }
 
 TEST_CASE( "update_components", "[settings][components]" )
 {
-  unsigned long testComponents = 10;
-  VECS_SETTINGS.update_max_components(testComponents);
+  SECTION( "within_limit" )
+  {
+    unsigned long testComponents = 10;
+    VECS_SETTINGS.update_max_components(testComponents);
+
+    CHECK( VECS_SETTINGS.max_components() == testComponents );
+  }
+
+  SECTION( "above_limit" )
+  {
+    VECS_SETTINGS.update_max_components(VECS_MAX_COMPONENTS + 1);
+
+    CHECK( VECS_SETTINGS.max_components() == VECS_MAX_COMPONENTS );
+  }
+}
+
+TEST_CASE( "update_worker_threads", "[settings][workerthreads]" )
+{
+  SECTION( "nonzero" )
+  {
+    unsigned int testThreads = 3;
+    VECS_SETTINGS.update_worker_threads(testThreads);
+
+    CHECK( VECS_SETTINGS.worker_threads() == testThreads );
+  }
+
+  SECTION( "zero" )
+  {
+    VECS_SETTINGS.update_worker_threads(0);
+
+    CHECK( VECS_SETTINGS.worker_threads() == 1 );
+  }
+}
+
+TEST_CASE( "update_run_limits", "[settings][runlimits]" )
+{
+  VECS_SETTINGS.update_time_step(0.01).update_max_steps(500).update_max_time(-1.0);
+
+  CHECK( VECS_SETTINGS.time_step() == 0.01 );
+  CHECK( VECS_SETTINGS.max_steps() == 500 );
+  CHECK( VECS_SETTINGS.max_time() == 0.0 );
+  CHECK_THROWS_AS( VECS_SETTINGS.update_time_step(0.0), std::runtime_error );
+}
+
+TEST_CASE( "update_catch_up", "[settings][catchup]" )
+{
+  VECS_SETTINGS.update_max_catch_up(0).update_frame_rate(30.0);
+
+  CHECK( VECS_SETTINGS.max_catch_up() == 1 );
+  CHECK( VECS_SETTINGS.frame_rate() == 30.0 );
+
+  VECS_SETTINGS.update_frame_rate(-1.0);
 
-  CHECK( VECS_SETTINGS.max_components() == testComponents );
+  CHECK( VECS_SETTINGS.frame_rate() == 0.0 );
 }
 
 TEST_CASE( "defaults", "[settings][defaults]" )
@@ -215,6 +308,8 @@ TEST_CASE( "defaults", "[settings][defaults]" )
   CHECK( VECS_SETTINGS.width() == 1280 );
   CHECK( VECS_SETTINGS.height() == 720 );
   CHECK( VECS_SETTINGS.portability_enabled() == false );
+  CHECK( VECS_SETTINGS.headless_enabled() == false );
+  CHECK( VECS_SETTINGS.compute_enabled() == true );
   CHECK( TEST::compare(VECS_SETTINGS.device_extensions(), { VK_KHR_SWAPCHAIN_EXTENSION_NAME }) );
   CHECK( VECS_SETTINGS.format() == vk::Format::eB8G8R8A8Srgb );
   CHECK( VECS_SETTINGS.color_space() == vk::ColorSpaceKHR::eSrgbNonlinear );
@@ -224,4 +319,10 @@ TEST_CASE( "defaults", "[settings][defaults]" )
   CHECK( VECS_SETTINGS.background_color().color.float32 == testColor.float32 );
   CHECK( VECS_SETTINGS.max_entities() == 20000 );
   CHECK( VECS_SETTINGS.max_components() == 100 );
+  CHECK( VECS_SETTINGS.worker_threads() == std::thread::hardware_concurrency() );
+  CHECK( VECS_SETTINGS.time_step() == 1.0 / 60.0 );
+  CHECK( VECS_SETTINGS.max_steps() == 0 );
+  CHECK( VECS_SETTINGS.max_time() == 0.0 );
+  CHECK( VECS_SETTINGS.max_catch_up() == 5 );
+  CHECK( VECS_SETTINGS.frame_rate() == 0.0 );
 }
\ No newline at end of file
@@ -5,11 +5,14 @@
 TEST_CASE( "initialize_empty", "[signature][initialization]" )
 {
   TEST::Signature signature;
-  
-  std::bitset<VECS_LIMIT> testBits;
-  testBits.set();
 
-  CHECK( (signature.bitset() & testBits) == 0UL );
+  CHECK( signature.empty() );
+}
+
+TEST_CASE( "size", "[signature][size]" )
+{
+  CHECK( TEST::Signature::words() == (VECS_MAX_COMPONENTS + 63) / 64 );
+  CHECK( sizeof(vecs::Signature) == TEST::Signature::words() * sizeof(std::uint64_t) );
 }
 
 TEST_CASE( "set", "[signature][set]" )
@@ -28,11 +31,8 @@ TEST_CASE( "set", "[signature][set]" )
 
   signature.set<TestType1, TestType2>();
 
-  std::bitset<VECS_LIMIT> testBits;
-  testBits.set(VECS_SETTINGS.component_id<TestType1>());
-  testBits.set(VECS_SETTINGS.component_id<TestType2>());
-
-  CHECK( (signature.bitset() & testBits) == testBits );
+  CHECK( signature.test(VECS_SETTINGS.component_id<TestType1>()) );
+  CHECK( signature.test(VECS_SETTINGS.component_id<TestType2>()) );
 }
 
 TEST_CASE( "unset", "[signature][unset]" )
@@ -53,35 +53,36 @@ TEST_CASE( "unset", "[signature][unset]" )
   };
 
   TEST::Signature signature;
-  std::bitset<VECS_LIMIT> testBits1, testBits2, testBits3;
 
-  testBits1.set(VECS_SETTINGS.component_id<TestType1>());
-  testBits2.set(VECS_SETTINGS.component_id<TestType2>());
-  testBits3.set(VECS_SETTINGS.component_id<TestType3>());
+  auto id1 = VECS_SETTINGS.component_id<TestType1>();
+  auto id2 = VECS_SETTINGS.component_id<TestType2>();
+  auto id3 = VECS_SETTINGS.component_id<TestType3>();
 
   signature.set<TestType1, TestType2, TestType3>();
   
   SECTION( "unset_all" )
   {
-    auto testBits = testBits1 & testBits2 & testBits3;
     signature.unset<TestType1, TestType2, TestType3>();
 
-    CHECK( (signature.bitset() & testBits) == 0UL );
+    CHECK( signature.empty() );
   }
 
   SECTION( "unset_one" )
   {
-    auto testBits = testBits1 & testBits2;
     signature.unset<TestType3>();
 
-    CHECK( (signature.bitset() & testBits) == testBits );
+    CHECK( signature.test(id1) );
+    CHECK( signature.test(id2) );
+    CHECK( !signature.test(id3) );
   }
 
   SECTION( "unset_multiple" )
   {
     signature.unset<TestType2, TestType3>();
 
-    CHECK( (signature.bitset() & testBits1) == testBits1 );
+    CHECK( signature.test(id1) );
+    CHECK( !signature.test(id2) );
+    CHECK( !signature.test(id3) );
   }
 }
 
@@ -107,8 +108,30 @@ TEST_CASE( "operator&", "[signatures][operator&]" )
   signature1.set<TestType1, TestType2>();
   signature2.set<TestType1, TestType2, TestType3>();
 
-  CHECK( !((signature1.bitset() & signature2.bitset()) == signature2.bitset()) );
-  CHECK( (signature2.bitset() & signature1.bitset()) == signature1.bitset() );
+  CHECK( !((signature1 & signature2) == signature2) );
+  CHECK( (signature2 & signature1) == signature1 );
+}
+
+TEST_CASE( "contains", "[signatures][contains]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+  
+  struct TestType2
+  {
+    int b = 1;
+  };
+
+  TEST::Signature signature1, signature2;
+
+  signature1.set<TestType1>();
+  signature2.set<TestType1, TestType2>();
+
+  CHECK( signature2.contains(signature1) );
+  CHECK( !signature1.contains(signature2) );
+  CHECK( signature1.contains(TEST::Signature{}) );
 }
 
 TEST_CASE( "operator==", "[signatures][operator==]" )
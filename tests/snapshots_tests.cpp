@@ -0,0 +1,307 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+namespace TEST
+{
+
+struct Velocity
+{
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+};
+
+} // namespace TEST
+
+template <>
+struct vecs::SoALayout<TEST::Velocity> : vecs::SoAFields<float, 3> {};
+
+TEST_CASE( "snapshot_round_trip", "[snapshots][roundtrip]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    double b = 2.0;
+  };
+
+  std::string path = (std::filesystem::temp_directory_path() / "vecs_snapshot_round_trip.vecs").string();
+
+  {
+    TEST::EntityManager e_manager;
+    vecs::ComponentManager c_manager;
+
+    c_manager.register_components<TestType1, TestType2>();
+
+    auto created = e_manager.create_entities<TestType1>(5000);
+    c_manager.generate_data<TestType1>(created, [](unsigned long i){ return TestType1{ static_cast<int>(i) }; });
+
+    e_manager.add_components<TestType2>(created[3]);
+    c_manager.update_data(created[3], TestType2{ 7.5 });
+
+    e_manager.remove_entity(created[1]);
+    c_manager.clear_data(created[1]);
+
+    vecs::Snapshot(path).save<TestType1, TestType2>(e_manager, c_manager);
+  }
+
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+
+  auto stale = e_manager.new_entity();
+  c_manager.register_components<TestType1>();
+  c_manager.update_data(stale, TestType1{ -1 });
+
+  auto query = e_manager.register_query<TestType2>();
+
+  vecs::Snapshot(path).load<TestType1, TestType2>(e_manager, c_manager);
+
+  CHECK( e_manager.count() == 4999 );
+  CHECK( !e_manager.valid(vecs::Entity(1)) );
+  CHECK( e_manager.valid(vecs::Entity(4999)) );
+  CHECK( e_manager.free_list() == std::vector<vecs::EntityIndex>{ 1 } );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(0)).a == 0 );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(4999)).a == 4999 );
+  CHECK( c_manager.get<TestType2>(vecs::Entity(3)).b == 7.5 );
+  CHECK( c_manager.try_get<TestType2>(vecs::Entity(0)) == nullptr );
+  CHECK( e_manager.retrieve<TestType2>() == std::set<vecs::Entity>{ vecs::Entity(3) } );
+  CHECK( query->size() == 1 );
+  CHECK( e_manager.new_entity() == vecs::Entity(1, 1) );
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE( "snapshot_soa", "[snapshots][soa]" )
+{
+  std::string path = (std::filesystem::temp_directory_path() / "vecs_snapshot_soa.vecs").string();
+
+  {
+    TEST::EntityManager e_manager;
+    vecs::ComponentManager c_manager;
+
+    c_manager.register_components<TEST::Velocity>();
+
+    auto created = e_manager.create_entities<TEST::Velocity>(3000);
+    c_manager.generate_data<TEST::Velocity>(created, [](unsigned long i){ return TEST::Velocity{ static_cast<float>(i), 1.0f, -2.0f }; });
+
+    vecs::Snapshot(path).save<TEST::Velocity>(e_manager, c_manager);
+  }
+
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+
+  vecs::Snapshot(path).load<TEST::Velocity>(e_manager, c_manager);
+
+  const auto * columns = std::as_const(c_manager).columns<TEST::Velocity>();
+  REQUIRE( columns != nullptr );
+
+  CHECK( columns->size() == 3000 );
+  CHECK( columns->at(vecs::Entity(2999)).x == 2999.0f );
+  CHECK( columns->column(1)[1500] == 1.0f );
+  CHECK( columns->column(2)[0] == -2.0f );
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE( "snapshot_errors", "[snapshots][errors]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  std::string path = (std::filesystem::temp_directory_path() / "vecs_snapshot_errors.vecs").string();
+
+  vecs::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::Snapshot snapshot(path);
+
+  SECTION( "missing" )
+  {
+    std::filesystem::remove(path);
+
+    CHECK_THROWS( snapshot.load<TestType1>(e_manager, c_manager) );
+  }
+
+  SECTION( "not_a_snapshot" )
+  {
+    std::ofstream(path) << "not a snapshot";
+
+    CHECK_THROWS( snapshot.load<TestType1>(e_manager, c_manager) );
+  }
+
+  SECTION( "component_mismatch" )
+  {
+    snapshot.save<TestType1>(e_manager, c_manager);
+
+    CHECK_THROWS( snapshot.load<TestType1, double>(e_manager, c_manager) );
+    CHECK_NOTHROW( snapshot.load<TestType1>(e_manager, c_manager) );
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE( "checkpoint_deltas", "[snapshots][checkpoint]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    double b = 2.0;
+  };
+
+  std::string path = (std::filesystem::temp_directory_path() / "vecs_checkpoint_deltas.vecs").string();
+
+  {
+    TEST::EntityManager e_manager;
+    vecs::ComponentManager c_manager;
+    vecs::Checkpoint checkpoint(path, 2);
+
+    checkpoint.track<TestType1, TestType2>();
+    c_manager.register_components<TestType1, TestType2>();
+
+    auto created = e_manager.create_entities<TestType1>(5000);
+    c_manager.generate_data<TestType1>(created, [](unsigned long i){ return TestType1{ static_cast<int>(i) }; });
+
+    checkpoint.update(e_manager, c_manager);
+    CHECK( checkpoint.records() == 0 );
+
+    checkpoint.update(e_manager, c_manager);
+    checkpoint.wait();
+    CHECK( checkpoint.records() == 1 );
+
+    auto base = std::filesystem::file_size(path);
+
+    c_manager.get<TestType1>(vecs::Entity(4500)).a = -5;
+
+    checkpoint.write(e_manager, c_manager);
+    checkpoint.wait();
+
+    CHECK( std::filesystem::file_size(path) - base < base / 8 );
+
+    e_manager.add_components<TestType2>(created[10]);
+    c_manager.update_data(created[10], TestType2{ 3.5 });
+    e_manager.remove_entity(created[0]);
+    c_manager.clear_data(created[0]);
+    c_manager.get<TestType1>(vecs::Entity(20)).a = 99;
+
+    checkpoint.write(e_manager, c_manager);
+    checkpoint.wait();
+    CHECK( checkpoint.records() == 3 );
+  }
+
+  {
+    std::ifstream input(path, std::ios::binary);
+    std::vector<char> header(100);
+    input.read(header.data(), header.size());
+
+    std::ofstream(path, std::ios::binary | std::ios::app).write(header.data(), header.size());
+  }
+
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::Checkpoint checkpoint(path);
+
+  checkpoint.track<TestType1, TestType2>();
+  checkpoint.restore(e_manager, c_manager);
+
+  CHECK( e_manager.count() == 4999 );
+  CHECK( !e_manager.valid(vecs::Entity(0)) );
+  CHECK( e_manager.free_list() == std::vector<vecs::EntityIndex>{ 0 } );
+  CHECK( c_manager.try_get<TestType1>(vecs::Entity(0)) == nullptr );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(20)).a == 99 );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(4500)).a == -5 );
+  CHECK( c_manager.get<TestType1>(vecs::Entity(4999)).a == 4999 );
+  CHECK( c_manager.get<TestType2>(vecs::Entity(10)).b == 3.5 );
+  CHECK( e_manager.retrieve<TestType2>() == std::set<vecs::Entity>{ vecs::Entity(10) } );
+
+  SECTION( "mismatch" )
+  {
+    vecs::Checkpoint other(path);
+    other.track<TestType1>();
+
+    CHECK_THROWS( other.restore(e_manager, c_manager) );
+  }
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE( "checkpoint_copy_on_write", "[snapshots][checkpoint]" )
+{
+  struct Mass
+  {
+    explicit Mass(float value) : value(value) {}
+
+    float value;
+  };
+
+  std::string path = (std::filesystem::temp_directory_path() / "vecs_checkpoint_copy_on_write.vecs").string();
+
+  {
+    TEST::EntityManager e_manager;
+    vecs::ComponentManager c_manager;
+    vecs::Checkpoint checkpoint(path);
+
+    checkpoint.track<TEST::Velocity, Mass>();
+    c_manager.register_components<TEST::Velocity, Mass>();
+
+    auto created = e_manager.create_entities<TEST::Velocity, Mass>(4000);
+    c_manager.generate_data<TEST::Velocity>(created, [](unsigned long i){ return TEST::Velocity{ static_cast<float>(i), 1.0f, -2.0f }; });
+    c_manager.generate_data<Mass>(created, [](unsigned long i){ return Mass(static_cast<float>(i)); });
+
+    checkpoint.write(e_manager, c_manager);
+    checkpoint.wait();
+
+    auto base = std::filesystem::file_size(path);
+
+    c_manager.update_data(created[3000], TEST::Velocity{ -1.0f, -1.0f, -1.0f });
+
+    checkpoint.write(e_manager, c_manager);
+    checkpoint.wait();
+
+    CHECK( std::filesystem::file_size(path) - base < base / 8 );
+
+    c_manager.update_data(created[5], TEST::Velocity{ 7.0f, 7.0f, 7.0f });
+    c_manager.get<Mass>(created[6]).value = 8.0f;
+    checkpoint.write(e_manager, c_manager);
+
+    c_manager.update_data(created[5], TEST::Velocity{ 0.5f, 0.5f, 0.5f });
+    c_manager.get<Mass>(created[6]).value = 0.5f;
+    checkpoint.write(e_manager, c_manager);
+
+    c_manager.update_data(created[5], TEST::Velocity{ 9.0f, 9.0f, 9.0f });
+    c_manager.get<Mass>(created[6]).value = -3.0f;
+    checkpoint.wait();
+
+    CHECK( checkpoint.records() == 4 );
+  }
+
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::Checkpoint checkpoint(path);
+
+  checkpoint.track<TEST::Velocity, Mass>();
+  checkpoint.restore(e_manager, c_manager);
+
+  const auto * columns = std::as_const(c_manager).columns<TEST::Velocity>();
+  REQUIRE( columns != nullptr );
+
+  CHECK( columns->size() == 4000 );
+  CHECK( columns->at(vecs::Entity(3000)).z == -1.0f );
+  CHECK( columns->at(vecs::Entity(5)).x == 0.5f );
+  CHECK( columns->at(vecs::Entity(3999)).x == 3999.0f );
+  CHECK( c_manager.get<Mass>(vecs::Entity(6)).value == 0.5f );
+  CHECK( c_manager.get<Mass>(vecs::Entity(3999)).value == 3999.0f );
+
+  std::filesystem::remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,198 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace TEST
+{
+
+struct Position
+{
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+};
+
+struct Location
+{
+  float x = 0.0f;
+  float y = 0.0f;
+  float z = 0.0f;
+};
+
+inline float scatter(unsigned long i, unsigned long axis)
+{
+  unsigned long hash = (i * 2654435761UL + axis * 40503UL) % 100003UL;
+  return static_cast<float>(hash) / 1000.0f;
+}
+
+inline std::vector<vecs::Entity> brute_radius(const vecs::SpatialIndex& index, const vecs::Point& center, float radius)
+{
+  std::vector<vecs::Entity> found;
+  for (unsigned long i = 0; i < index.size(); ++i)
+  {
+    const vecs::Point& point = index.points()[i];
+    float x = point[0] - center[0], y = point[1] - center[1], z = point[2] - center[2];
+    if (x * x + y * y + z * z <= radius * radius)
+      found.push_back(index.entities()[i]);
+  }
+
+  std::sort(found.begin(), found.end());
+  return found;
+}
+
+inline std::vector<vecs::Entity> brute_nearest(const vecs::SpatialIndex& index, const vecs::Point& center, unsigned long count)
+{
+  std::vector<std::pair<float, vecs::Entity>> found;
+  for (unsigned long i = 0; i < index.size(); ++i)
+  {
+    const vecs::Point& point = index.points()[i];
+    float x = point[0] - center[0], y = point[1] - center[1], z = point[2] - center[2];
+    found.emplace_back(x * x + y * y + z * z, index.entities()[i]);
+  }
+
+  std::sort(found.begin(), found.end());
+
+  std::vector<vecs::Entity> nearest;
+  for (unsigned long i = 0; i < std::min(count, found.size()); ++i)
+    nearest.push_back(found[i].second);
+
+  return nearest;
+}
+
+inline std::vector<vecs::Entity> sorted(std::vector<vecs::Entity> entities)
+{
+  std::sort(entities.begin(), entities.end());
+  return entities;
+}
+
+} // namespace TEST
+
+template <>
+struct vecs::SoALayout<TEST::Location> : vecs::SoAFields<float, 3> {};
+
+TEST_CASE( "spatial_grid_queries", "[spatial][grid]" )
+{
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+
+  c_manager.register_components<TEST::Position>();
+
+  auto created = e_manager.create_entities<TEST::Position>(3000);
+  c_manager.generate_data<TEST::Position>(created, [](unsigned long i){
+    return TEST::Position{ TEST::scatter(i, 0), TEST::scatter(i, 1), TEST::scatter(i, 2) };
+  });
+
+  vecs::SpatialGrid grid(5.0f);
+  grid.rebuild<TEST::Position>(c_manager);
+
+  CHECK( grid.size() == 3000 );
+  CHECK( grid.cell_size() == 5.0f );
+
+  for (vecs::Point center : { vecs::Point{ 50.0f, 50.0f, 50.0f }, vecs::Point{ 0.0f, 100.0f, 3.0f }, vecs::Point{ -20.0f, 10.0f, 10.0f } })
+  {
+    CHECK( TEST::sorted(grid.radius(center, 12.0f)) == TEST::brute_radius(grid, center, 12.0f) );
+    CHECK( grid.nearest(center, 10) == TEST::brute_nearest(grid, center, 10) );
+  }
+
+  CHECK( TEST::sorted(grid.radius({ 50.0f, 50.0f, 50.0f }, 500.0f)).size() == 3000 );
+  CHECK( grid.nearest({ 50.0f, 50.0f, 50.0f }, 5000).size() == 3000 );
+
+  unsigned long visited = 0;
+  grid.each({ 50.0f, 50.0f, 50.0f }, 12.0f, [&](vecs::Entity){ ++visited; });
+  CHECK( visited == TEST::brute_radius(grid, { 50.0f, 50.0f, 50.0f }, 12.0f).size() );
+
+  const TEST::Position& first = c_manager.get<TEST::Position>(created[0]);
+  auto cell = grid.cell({ first.x, first.y, first.z });
+  CHECK( std::find(cell.begin(), cell.end(), created[0]) != cell.end() );
+
+  float infinity = std::numeric_limits<float>::infinity();
+  CHECK( grid.radius({ 50.0f, 50.0f, 50.0f }, infinity).size() == 3000 );
+  CHECK( TEST::sorted(grid.radius({ 1e30f, -1e30f, 0.0f }, 1e30f)) == TEST::brute_radius(grid, { 1e30f, -1e30f, 0.0f }, 1e30f) );
+  CHECK( grid.cell({ infinity, -infinity, 1e30f }).size() <= 3000 );
+
+  std::vector<vecs::Entity> corners = { vecs::Entity(0), vecs::Entity(1) };
+  std::vector<vecs::Point> extremes = { vecs::Point{ 0.1f, 0.2f, 0.3f }, vecs::Point{ 1e7f + 0.7f, -3.3e6f, 2.9e6f } };
+  grid.rebuild(corners, extremes);
+  CHECK( grid.nearest({ 0.1f, 0.2f, 0.3f }, 2) == std::vector<vecs::Entity>{ vecs::Entity(0), vecs::Entity(1) } );
+  CHECK( grid.nearest({ 1e7f, 1e7f, -1e7f }, 5).size() == 2 );
+
+  CHECK_THROWS_AS( vecs::SpatialGrid(0.0f), std::runtime_error );
+}
+
+TEST_CASE( "spatial_tree_queries", "[spatial][tree]" )
+{
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+
+  c_manager.register_components<TEST::Location>();
+
+  auto created = e_manager.create_entities<TEST::Location>(3000);
+  c_manager.generate_data<TEST::Location>(created, [](unsigned long i){
+    float spread = i % 10 == 0 ? 1.0f : 0.01f;
+    return TEST::Location{ TEST::scatter(i, 0) * spread, TEST::scatter(i, 1) * spread, TEST::scatter(i, 2) * spread };
+  });
+
+  vecs::SpatialTree tree(8);
+  tree.rebuild<TEST::Location>(c_manager);
+
+  CHECK( tree.size() == 3000 );
+  CHECK( tree.node_count() > 3000 / 8 );
+
+  for (vecs::Point center : { vecs::Point{ 0.5f, 0.5f, 0.5f }, vecs::Point{ 50.0f, 50.0f, 50.0f }, vecs::Point{ 200.0f, 0.0f, 0.0f } })
+  {
+    CHECK( TEST::sorted(tree.radius(center, 0.2f)) == TEST::brute_radius(tree, center, 0.2f) );
+    CHECK( TEST::sorted(tree.radius(center, 20.0f)) == TEST::brute_radius(tree, center, 20.0f) );
+    CHECK( tree.nearest(center, 16) == TEST::brute_nearest(tree, center, 16) );
+  }
+
+  std::vector<vecs::Entity> entities = { vecs::Entity(4), vecs::Entity(9) };
+  std::vector<vecs::Point> points = { vecs::Point{ 1.0f, 0.0f, 0.0f }, vecs::Point{ 3.0f, 0.0f, 0.0f } };
+  tree.rebuild(entities, points);
+
+  CHECK( tree.nearest({ 2.5f, 0.0f, 0.0f }, 1) == std::vector<vecs::Entity>{ vecs::Entity(9) } );
+  CHECK( tree.radius({ 0.0f, 0.0f, 0.0f }, 0.5f).empty() );
+  CHECK_THROWS_AS( tree.rebuild(entities, std::span<const vecs::Point>(points).first(1)), std::runtime_error );
+
+  tree.rebuild(std::span<const vecs::Entity>(), std::span<const vecs::Point>());
+  CHECK( tree.node_count() == 0 );
+  CHECK( tree.nearest({ 0.0f, 0.0f, 0.0f }, 4).empty() );
+}
+
+TEST_CASE( "spatial_parallel_rebuild", "[spatial][parallel]" )
+{
+  TEST::EntityManager e_manager;
+  vecs::ComponentManager c_manager;
+  vecs::ThreadPool pool(4);
+
+  c_manager.register_components<TEST::Position>();
+
+  auto created = e_manager.create_entities<TEST::Position>(40000);
+  c_manager.generate_data<TEST::Position>(created, [](unsigned long i){
+    return TEST::Position{ TEST::scatter(i, 0), TEST::scatter(i, 1), TEST::scatter(i, 2) };
+  });
+
+  auto doubled = [](const TEST::Position& p){ return vecs::Point{ p.x * 2.0f, p.y * 2.0f, p.z * 2.0f }; };
+
+  vecs::SpatialGrid serialGrid(4.0f), parallelGrid(4.0f);
+  serialGrid.rebuild<TEST::Position>(c_manager, doubled);
+  parallelGrid.rebuild<TEST::Position>(c_manager, doubled, &pool);
+
+  vecs::SpatialTree serialTree, parallelTree;
+  serialTree.rebuild<TEST::Position>(c_manager);
+  parallelTree.rebuild<TEST::Position>(c_manager, vecs::Coordinates{}, &pool);
+
+  CHECK( std::equal(serialGrid.entities().begin(), serialGrid.entities().end(), parallelGrid.entities().begin()) );
+  CHECK( std::equal(serialTree.entities().begin(), serialTree.entities().end(), parallelTree.entities().begin()) );
+  CHECK( serialTree.node_count() == parallelTree.node_count() );
+
+  vecs::Point center = { 100.0f, 100.0f, 100.0f };
+  CHECK( TEST::sorted(parallelGrid.radius(center, 10.0f)) == TEST::brute_radius(parallelGrid, center, 10.0f) );
+  CHECK( parallelGrid.nearest(center, 32) == TEST::brute_nearest(parallelGrid, center, 32) );
+  CHECK( TEST::sorted(parallelTree.radius({ 50.0f, 50.0f, 50.0f }, 5.0f)) == TEST::brute_radius(parallelTree, { 50.0f, 50.0f, 50.0f }, 5.0f) );
+  CHECK( parallelTree.nearest({ 50.0f, 50.0f, 50.0f }, 32) == TEST::brute_nearest(parallelTree, { 50.0f, 50.0f, 50.0f }, 32) );
+}
\ No newline at end of file
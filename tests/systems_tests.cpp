@@ -2,6 +2,11 @@
 
 #include <catch2/catch_test_macros.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <functional>
+
 TEST_CASE( "system_add", "[systems][systemadd]" )
 {
   struct TestType1
@@ -17,7 +22,7 @@ TEST_CASE( "system_add", "[systems][systemadd]" )
   class TestSystem : public vecs::System
   {
     public:
-      void update(const std::shared_ptr<vecs::ComponentManager>&, std::set<unsigned long>) override {}
+      void update(const std::shared_ptr<vecs::ComponentManager>&, const vecs::View&) override {}
   };
 
   TestSystem system;
@@ -57,11 +62,167 @@ TEST_CASE( "system_update", "[systems][systemupdate]" )
   TEST::System system;
   TEST::Signature signature;
 
-  system.update(nullptr, {});
+  system.update(nullptr, std::set<vecs::Entity>{});
 
   CHECK ( system.updated );
 }
 
+TEST_CASE( "system_update_view", "[systems][systemupdateview]" )
+{
+  class ViewSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>&, const vecs::View& e_ids) override
+      {
+        for (const auto& e_id : e_ids)
+          total += e_id.index();
+      }
+
+    public:
+      unsigned long total = 0;
+  };
+
+  std::vector<vecs::Entity> entities{ vecs::Entity(1), vecs::Entity(2), vecs::Entity(3) };
+
+  SECTION( "set_to_view" )
+  {
+    ViewSystem system;
+    vecs::System& base = system;
+
+    base.update(nullptr, std::set<vecs::Entity>{ vecs::Entity(1), vecs::Entity(2), vecs::Entity(3) });
+
+    CHECK( system.total == 6 );
+  }
+
+  SECTION( "view" )
+  {
+    ViewSystem system;
+    vecs::System& base = system;
+
+    base.update(nullptr, vecs::View(entities));
+
+    CHECK( system.total == 6 );
+  }
+}
+
+TEST_CASE( "system_queries", "[systems][queries]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  class CountSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>&, const vecs::View& e_ids) override
+      {
+        seen = 0;
+        for (auto itr = e_ids.begin(); itr != e_ids.end(); ++itr)
+          ++seen;
+      }
+
+    public:
+      unsigned long seen = 0;
+  };
+
+  class OtherCountSystem : public CountSystem {};
+
+  TEST::EntityManager e_manager;
+  auto c_manager = std::make_shared<vecs::ComponentManager>();
+  TEST::SystemManager s_manager;
+
+  s_manager.emplace<CountSystem, OtherCountSystem>();
+  s_manager.add_components<CountSystem, TestType1>();
+  s_manager.add_components<OtherCountSystem, TestType1>();
+
+  auto e_id = e_manager.new_entity();
+  e_manager.add_components<TestType1>(e_id);
+  e_manager.new_entity();
+
+  auto system = s_manager.system<CountSystem>().value();
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( system->seen == 1 );
+  CHECK( e_manager.query_count() == 1 );
+
+  e_manager.add_components<TestType1>(vecs::Entity(1));
+  s_manager.erase<OtherCountSystem>();
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( system->seen == 2 );
+  CHECK( e_manager.query_count() == 1 );
+
+  e_manager.remove_entity(e_id);
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( system->seen == 1 );
+
+  e_manager.new_entity();
+  s_manager.remove_components<CountSystem, TestType1>();
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( system->seen == 2 );
+  CHECK( e_manager.query_count() == 1 );
+
+  s_manager.erase<CountSystem>();
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( e_manager.query_count() == 0 );
+}
+
+TEST_CASE( "system_archetypes", "[systems][archetypes]" )
+{
+  struct TestType1
+  {
+    int a = 0;
+  };
+
+  class SumSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>&, const vecs::View&) override
+      {}
+
+      void update_archetypes(const std::shared_ptr<vecs::ArchetypeManager>&, std::span<const std::shared_ptr<vecs::Archetype>> tables) override
+      {
+        sum = 0;
+        for (const auto& table : tables)
+        {
+          for (auto& t1 : table->column<TestType1>())
+            sum += t1.a;
+        }
+      }
+
+    public:
+      int sum = 0;
+  };
+
+  vecs::EntityManager e_manager;
+  auto a_manager = std::make_shared<vecs::ArchetypeManager>(e_manager);
+  TEST::SystemManager s_manager;
+
+  s_manager.emplace<SumSystem>();
+  s_manager.add_components<SumSystem, TestType1>();
+
+  for (int i = 0; i < 4; ++i)
+  {
+    auto e_id = a_manager->new_entity();
+    a_manager->add_components<TestType1>(e_id, { i });
+  }
+  a_manager->new_entity();
+
+  auto system = s_manager.system<SumSystem>().value();
+  s_manager.update(a_manager);
+
+  CHECK( system->sum == 6 );
+
+  a_manager->remove_entity(vecs::Entity(3));
+  s_manager.update(a_manager);
+
+  CHECK( system->sum == 3 );
+}
+
 TEST_CASE( "emplace", "[systems][emplace]" )
 {  
   TEST::SystemManager manager;
@@ -144,4 +305,316 @@ TEST_CASE( "remove_components", "[systems][remove_components]" )
   signature.set<TestType1, TestType2>();
 
   CHECK( system->signature() != signature );
+}
+
+TEST_CASE( "system_access", "[systems][access]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    int b = 1;
+  };
+
+  TEST::System reader1;
+  TEST::System reader2;
+  TEST::System writer;
+  TEST::System exclusive;
+
+  reader1.readComponents<TestType1>();
+  reader2.readComponents<TestType1>();
+  writer.writeComponents<TestType1>();
+  writer.readComponents<TestType2>();
+
+  CHECK( !reader1.conflicts(reader2) );
+  CHECK( reader1.conflicts(writer) );
+  CHECK( writer.conflicts(reader2) );
+  CHECK( exclusive.conflicts(reader1) );
+  CHECK( reader1.conflicts(exclusive) );
+
+  SECTION( "disjoint_writes" )
+  {
+    TEST::System other;
+    other.writeComponents<TestType2>();
+
+    CHECK( writer.conflicts(other) );
+    CHECK( !reader1.conflicts(other) );
+  }
+}
+
+TEST_CASE( "system_update_parallel", "[systems][updateparallel]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  struct TestType2
+  {
+    int b = 1;
+  };
+
+  class ReadSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, const vecs::View& e_ids) override
+      {
+        for (const auto& e_id : e_ids)
+          total += c_manager->get<TestType1>(e_id).a;
+      }
+
+    public:
+      int total = 0;
+  };
+
+  class OtherReadSystem : public ReadSystem {};
+
+  class WriteSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, const vecs::View& e_ids) override
+      {
+        for (const auto& e_id : e_ids)
+          c_manager->get<TestType1>(e_id).a += c_manager->get<TestType2>(e_id).b;
+      }
+  };
+
+  VECS_SETTINGS.update_worker_threads(2);
+
+  auto c_manager = std::make_shared<vecs::ComponentManager>();
+  vecs::EntityManager e_manager;
+  TEST::SystemManager s_manager;
+
+  c_manager->register_components<TestType1, TestType2>();
+
+  for (int i = 0; i < 10; ++i)
+  {
+    auto e_id = e_manager.new_entity();
+    e_manager.add_components<TestType1, TestType2>(e_id);
+    c_manager->update_data(e_id, TestType1{}, TestType2{});
+  }
+
+  s_manager.emplace<ReadSystem>();
+  s_manager.emplace<OtherReadSystem>();
+  s_manager.emplace<WriteSystem>();
+
+  s_manager.add_components<ReadSystem, TestType1>();
+  s_manager.add_components<OtherReadSystem, TestType1>();
+  s_manager.add_components<WriteSystem, TestType1, TestType2>();
+
+  s_manager.read_components<ReadSystem, TestType1>();
+  s_manager.read_components<OtherReadSystem, TestType1>();
+  s_manager.write_components<WriteSystem, TestType1>();
+  s_manager.read_components<WriteSystem, TestType2>();
+
+  CHECK( s_manager.stage_count() == 2 );
+
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( s_manager.system<ReadSystem>().value()->total == 10 );
+  CHECK( s_manager.system<OtherReadSystem>().value()->total == 10 );
+  CHECK( c_manager->get<TestType1>(vecs::Entity(0)).a == 2 );
+
+  SECTION( "exclusive" )
+  {
+    s_manager.emplace<TEST::System>();
+
+    CHECK( s_manager.stage_count() == 3 );
+  }
+
+  VECS_SETTINGS.set_default();
+}
+
+TEST_CASE( "system_parallel_each", "[systems][paralleleach]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  VECS_SETTINGS.update_worker_threads(4);
+
+  TEST::SystemManager s_manager;
+  vecs::EntityManager e_manager;
+
+  s_manager.emplace<TEST::System>();
+  auto system = s_manager.system<TEST::System>().value();
+
+  std::vector<vecs::Entity> entities;
+  for (unsigned long i = 0; i < 1000; ++i)
+  {
+    auto e_id = e_manager.new_entity();
+    if (i % 2 == 0) e_manager.add_components<TestType1>(e_id);
+    entities.emplace_back(e_id);
+  }
+
+  SECTION( "span" )
+  {
+    std::vector<unsigned long> seen(entities.size(), 0);
+
+    system->parallel_each(std::span<const vecs::Entity>(entities), [&seen](vecs::Entity e_id){ ++seen[e_id.index()]; }, 16);
+
+    CHECK( std::ranges::all_of(seen, [](unsigned long count){ return count == 1; }) );
+  }
+
+  SECTION( "view" )
+  {
+    std::atomic<unsigned long> total = 0;
+
+    system->parallel_each(e_manager.view<TestType1>(), [&total](vecs::Entity){ ++total; }, 16);
+
+    CHECK( total == 500 );
+  }
+
+  SECTION( "query" )
+  {
+    auto query = e_manager.register_query<TestType1>();
+    std::atomic<unsigned long> total = 0;
+
+    system->parallel_each(*query, [&total](vecs::Entity){ ++total; }, 16);
+
+    CHECK( total == 500 );
+
+    system->parallel_each(query, [&total](vecs::Entity){ ++total; }, 16);
+
+    CHECK( total == 1000 );
+    CHECK( system->parallel_reduce(query, 0ul, [](vecs::Entity){ return 1ul; }, std::plus<unsigned long>{}, 16) == 500 );
+  }
+
+  SECTION( "chunks" )
+  {
+    std::vector<unsigned long> firsts(10, 0);
+
+    system->parallel_each(entities, [&firsts](std::span<const vecs::Entity> chunk, unsigned long index){
+      firsts[index] = chunk.front().index();
+    }, 100);
+
+    CHECK( firsts == std::vector<unsigned long>{ 0, 100, 200, 300, 400, 500, 600, 700, 800, 900 } );
+  }
+
+  SECTION( "reduce" )
+  {
+    auto sum = system->parallel_reduce(entities, 0.0, [](vecs::Entity e_id){ return 0.1 * e_id.index(); }, std::plus<double>{}, 7);
+    auto again = system->parallel_reduce(entities, 0.0, [](vecs::Entity e_id){ return 0.1 * e_id.index(); }, std::plus<double>{}, 7);
+
+    CHECK( sum == again );
+    CHECK( std::abs(sum - 49950.0) < 1e-6 );
+  }
+
+  SECTION( "reduce_init" )
+  {
+    std::span<const vecs::Entity> first(entities.data(), 12);
+
+    auto sum = system->parallel_reduce(first, 10ul, [](vecs::Entity e_id){ return e_id.index(); }, std::plus<unsigned long>{}, 4);
+    auto product = system->parallel_reduce(first.subspan(1, 6), 2ul, [](vecs::Entity e_id){ return e_id.index(); }, std::multiplies<unsigned long>{}, 2);
+    auto empty = system->parallel_reduce(first.first(0), 7ul, [](vecs::Entity e_id){ return e_id.index(); }, std::plus<unsigned long>{}, 4);
+
+    CHECK( sum == 10 + 66 );
+    CHECK( product == 2 * 720 );
+    CHECK( empty == 7 );
+  }
+
+  VECS_SETTINGS.set_default();
+}
+
+TEST_CASE( "system_commands", "[systems][commands]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  class SpawnSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>&, const vecs::View& e_ids) override
+      {
+        parallel_each(e_ids, [this](vecs::Entity e_id){
+          commands().despawn(e_id);
+          commands().add_components(commands().spawn(), TestType1{ 2 });
+        }, 4);
+      }
+  };
+
+  auto c_manager = std::make_shared<vecs::ComponentManager>();
+  vecs::EntityManager e_manager;
+  TEST::SystemManager s_manager;
+
+  c_manager->register_components<TestType1>();
+
+  for (int i = 0; i < 16; ++i)
+  {
+    auto e_id = e_manager.new_entity();
+    e_manager.add_components<TestType1>(e_id);
+    c_manager->update_data(e_id, TestType1{});
+  }
+
+  s_manager.emplace<SpawnSystem>();
+  s_manager.add_components<SpawnSystem, TestType1>();
+  s_manager.update(c_manager, e_manager);
+
+  CHECK( e_manager.count() == 16 );
+
+  int total = 0;
+  for (const auto& e_id : e_manager.view<TestType1>())
+    total += c_manager->get<TestType1>(e_id).a;
+
+  CHECK( total == 32 );
+}
+
+TEST_CASE( "system_change_ticks", "[systems][changeticks]" )
+{
+  struct TestType1
+  {
+    int a = 1;
+  };
+
+  class ChangeSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, const vecs::View& e_ids) override
+      {
+        count = 0;
+        for (vecs::Entity e_id : c_manager->filter(e_ids, vecs::Changed<TestType1>{ last_tick() }))
+        {
+          static_cast<void>(e_id);
+          ++count;
+        }
+      }
+
+    public:
+      int count = 0;
+  };
+
+  auto c_manager = std::make_shared<vecs::ComponentManager>();
+  vecs::EntityManager e_manager;
+  TEST::SystemManager s_manager;
+
+  c_manager->register_components<TestType1>();
+
+  for (int i = 0; i < 4; ++i)
+  {
+    auto e_id = e_manager.new_entity();
+    e_manager.add_components<TestType1>(e_id);
+    c_manager->update_data(e_id, TestType1{});
+  }
+
+  s_manager.emplace<ChangeSystem>();
+  s_manager.add_components<ChangeSystem, TestType1>();
+  s_manager.read_components<ChangeSystem, TestType1>();
+
+  auto system = s_manager.system<ChangeSystem>().value();
+
+  s_manager.update(c_manager, e_manager);
+  CHECK( system->count == 4 );
+
+  s_manager.update(c_manager, e_manager);
+  CHECK( system->count == 0 );
+
+  c_manager->update_data(vecs::Entity(2), TestType1{ 3 });
+  s_manager.update(c_manager, e_manager);
+  CHECK( system->count == 1 );
 }
\ No newline at end of file
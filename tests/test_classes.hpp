@@ -3,45 +3,86 @@
 
 #include "vecs/vecs.hpp"
 
-#include <bitset>
 #include <memory>
-#include <stack>
+#include <memory_resource>
+#include <vector>
 
 namespace TEST
 {
 
+class CountingResource : public std::pmr::memory_resource
+{
+  public:
+    unsigned long allocations = 0;
+    unsigned long bytes = 0;
+
+  private:
+    void * do_allocate(std::size_t size, std::size_t alignment) override
+    {
+      ++allocations;
+      bytes += size;
+      return std::pmr::new_delete_resource()->allocate(size, alignment);
+    }
+
+    void do_deallocate(void * p, std::size_t size, std::size_t alignment) override
+    {
+      bytes -= size;
+      std::pmr::new_delete_resource()->deallocate(p, size, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    { return this == &other; }
+};
+
 class Signature : public vecs::Signature
 {
   public:
-    const std::bitset<VECS_LIMIT>& bitset() const
-    { return bits; }
+    bool test(unsigned short id) const
+    { return bits[id / word_bits] & (std::uint64_t{1} << (id % word_bits)); }
+
+    bool empty() const
+    { return *this == vecs::Signature{}; }
+
+    static constexpr unsigned long words()
+    { return word_count; }
+};
+
+class ArchetypeManager : public vecs::ArchetypeManager
+{
+  public:
+    using vecs::ArchetypeManager::ArchetypeManager;
+
+    unsigned long archetype_count() const
+    { return archetypes.size(); }
 };
 
 class EntityManager : public vecs::EntityManager
 {
   public:
+    using vecs::EntityManager::EntityManager;
+
     template <typename T>
-    bool has_component(unsigned long e_id) const
+    bool has_component(vecs::Entity e_id) const
     {
       if (!valid(e_id)) return false;
       
       TEST::Signature signature;
       signature.set<T>();
 
-      return (signatures[indexMap.at(e_id)] & signature) == signature;
+      return signatures[indices[e_id.index()]].contains(signature);
     }
 
-    const std::stack<unsigned long>& stack() const
-    { return nextID; }
-    
-    const unsigned long stack_top() const
-    { return nextID.top(); }
+    std::vector<vecs::EntityIndex> free_list() const
+    { return std::vector<vecs::EntityIndex>(freeIndices.begin(), freeIndices.end()); }
 
-    const unsigned long index_of(unsigned long e_id) const
-    { return indexMap.at(e_id); }
+    unsigned long index_of(vecs::Entity e_id) const
+    { return indices[e_id.index()]; }
 
-    const unsigned long id_of(unsigned long index) const
-    { return idMap.at(index); }
+    vecs::Entity id_of(unsigned long index) const
+    { return entities[index]; }
+
+    unsigned long query_count() const
+    { return queries.size(); }
 };
 
 template <typename T>
@@ -50,14 +91,13 @@ class ComponentArray : public vecs::ComponentArray<T>
   public:
     ComponentArray() = default;
     ComponentArray(vecs::ComponentArray<T>& array) : vecs::ComponentArray<T>(array) {}
-    
-    bool contains(unsigned long e_id) const
-    { return vecs::ComponentArray<T>::valid(e_id); }
 };
 
 class ComponentManager : public vecs::ComponentManager
 {
   public:
+    using vecs::ComponentManager::ComponentManager;
+
     template <typename T>
     std::shared_ptr<vecs::ComponentArray<T>> component_array()
     { return array<T>(); }
@@ -66,7 +106,9 @@ class ComponentManager : public vecs::ComponentManager
 class System : public vecs::System
 {
   public:
-    void update(const std::shared_ptr<vecs::ComponentManager>&, std::set<unsigned long>)
+    using vecs::System::update;
+
+    void update(const std::shared_ptr<vecs::ComponentManager>&, const vecs::View&) override
     { updated = true; }
 
   public:
@@ -79,6 +121,12 @@ class SystemManager : public vecs::SystemManager
     template <typename T>
     bool has_system() const
     { return registered<T>(); }
+
+    unsigned long stage_count()
+    {
+      schedule();
+      return stages.size();
+    }
 };
 
 } // namespace TEST
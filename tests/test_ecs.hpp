@@ -19,17 +19,14 @@ struct ComponentB
 class SystemA : public vecs::System
 {
   public:
-    void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, std::set<unsigned long> e_ids)
+    void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, const vecs::View& e_ids) override
     {
       for (const auto& e_id : e_ids)
       {
-        auto data_opt = c_manager->retrieve<ComponentA>(e_id);
-        if (data_opt == std::nullopt) continue;
+        auto * data = c_manager->try_get<ComponentA>(e_id);
+        if (data == nullptr) continue;
         
-        auto data = data_opt.value();
-        data.number += 1;
-
-        c_manager->update_data<ComponentA>(e_id, data);
+        data->number += 1;
       }
     }
 };
@@ -37,20 +34,15 @@ class SystemA : public vecs::System
 class SystemB : public vecs::System
 {
   public:
-    void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, std::set<unsigned long> e_ids)
+    void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, const vecs::View& e_ids) override
     {
       for (const auto& e_id : e_ids)
       {
-        auto dataA_opt = c_manager->retrieve<ComponentA>(e_id);
-        auto dataB_opt = c_manager->retrieve<ComponentB>(e_id);
-        if (dataA_opt == std::nullopt || dataB_opt == std::nullopt) continue;
-        
-        auto dataA = dataA_opt.value();
-        auto dataB = dataB_opt.value();
+        auto * dataA = c_manager->try_get<ComponentA>(e_id);
+        const auto * dataB = std::as_const(*c_manager).try_get<ComponentB>(e_id);
+        if (dataA == nullptr || dataB == nullptr) continue;
         
-        dataA.number *= dataB.multiplier;
-
-        c_manager->update_data<ComponentA>(e_id, dataA);
+        dataA->number *= dataB->multiplier;
       }
     }
 };
@@ -60,8 +52,8 @@ class Engine : public vecs::Engine
   public:
     const std::pair<int, int> final_values() const
     {
-      auto data0 = component_manager->retrieve<ComponentA>(0);
-      auto data1 = component_manager->retrieve<ComponentA>(1);
+      auto data0 = component_manager->retrieve<ComponentA>(vecs::Entity(0));
+      auto data1 = component_manager->retrieve<ComponentA>(vecs::Entity(1));
 
       return std::make_pair(data0.value().number, data1.value().number);
     }
@@ -73,15 +65,15 @@ class Engine : public vecs::Engine
       system_manager->add_components<SystemB, ComponentA, ComponentB>();
 
       component_manager->register_components<ComponentA, ComponentB>();
-      component_manager->update_data<ComponentA>(0, { 1 });
-      component_manager->update_data<ComponentA>(1, { 1 });
-      component_manager->update_data<ComponentB>(1, { 2 });
+      component_manager->update_data<ComponentA>(vecs::Entity(0), { 1 });
+      component_manager->update_data<ComponentA>(vecs::Entity(1), { 1 });
+      component_manager->update_data<ComponentB>(vecs::Entity(1), { 2 });
 
       entity_manager->new_entity();
-      entity_manager->add_components<ComponentA>(0);
+      entity_manager->add_components<ComponentA>(vecs::Entity(0));
       
       entity_manager->new_entity();
-      entity_manager->add_components<ComponentA, ComponentB>(1);
+      entity_manager->add_components<ComponentA, ComponentB>(vecs::Entity(1));
 
       initialize();
     }
@@ -90,13 +82,15 @@ class Engine : public vecs::Engine
     {
       auto systemA = system_manager->system<SystemA>().value();
       auto systemB = system_manager->system<SystemB>().value();
+
+      auto queryB = entity_manager->register_query(systemB->signature(), true);
       
       while (!close_condition())
       {
         poll_gui();
 
-        systemA->update(component_manager, entity_manager->retrieve<ComponentA>());
-        systemB->update(component_manager, entity_manager->retrieve<ComponentA, ComponentB>(true));
+        systemA->update(component_manager, entity_manager->view(systemA->signature()));
+        systemB->update(component_manager, queryB->view());
 
         ++loopCounter;
       }
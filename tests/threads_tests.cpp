@@ -0,0 +1,119 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST_CASE( "thread_pool_size", "[threads][size]" )
+{
+  vecs::ThreadPool pool(3);
+
+  CHECK( pool.size() == 3 );
+}
+
+TEST_CASE( "thread_pool_submit", "[threads][submit]" )
+{
+  vecs::ThreadPool pool(4);
+  std::atomic<unsigned long> total = 0;
+
+  for (unsigned long i = 1; i <= 100; ++i)
+    pool.submit([&total, i](){ total += i; });
+
+  pool.wait();
+
+  CHECK( total == 5050 );
+
+  SECTION( "reuse" )
+  {
+    pool.submit([&total](){ total = 0; });
+    pool.wait();
+
+    CHECK( total == 0 );
+  }
+}
+
+TEST_CASE( "thread_pool_exception", "[threads][exception]" )
+{
+  vecs::ThreadPool pool(2);
+  std::atomic<unsigned long> count = 0;
+
+  pool.submit([](){ throw std::runtime_error("task failed"); });
+  for (unsigned long i = 0; i < 10; ++i)
+    pool.submit([&count](){ ++count; });
+
+  CHECK_THROWS_AS( pool.wait(), std::runtime_error );
+  CHECK( count == 10 );
+
+  SECTION( "cleared" )
+  {
+    pool.submit([&count](){ ++count; });
+
+    CHECK_NOTHROW( pool.wait() );
+    CHECK( count == 11 );
+  }
+}
+
+TEST_CASE( "thread_pool_parallel_for", "[threads][parallelfor]" )
+{
+  vecs::ThreadPool pool(4);
+  std::vector<unsigned long> values(1000, 0);
+
+  pool.parallel_for(values.size(), [&values](unsigned long i){ values[i] = i; });
+
+  bool ordered = true;
+  for (unsigned long i = 0; i < values.size(); ++i)
+    ordered = ordered && values[i] == i;
+
+  CHECK( ordered );
+
+  SECTION( "nested" )
+  {
+    std::atomic<unsigned long> total = 0;
+
+    pool.parallel_for(8, [&pool, &total](unsigned long){
+      pool.parallel_for(8, [&total](unsigned long){ ++total; });
+    });
+
+    CHECK( total == 64 );
+  }
+
+  SECTION( "concurrent" )
+  {
+    std::atomic<unsigned long> total = 0;
+    std::vector<std::thread> callers;
+
+    for (int c = 0; c < 4; ++c)
+      callers.emplace_back([&pool, &total](){
+        for (int r = 0; r < 200; ++r)
+          pool.parallel_for(16, [&total](unsigned long i){ total += i; });
+      });
+
+    for (int s = 0; s < 100; ++s)
+      pool.submit([&total](){ total += 1; });
+
+    for (auto& caller : callers)
+      caller.join();
+    pool.wait();
+
+    CHECK( total == 4 * 200 * 120 + 100 );
+  }
+
+  SECTION( "empty" )
+  {
+    unsigned long calls = 0;
+    pool.parallel_for(0, [&calls](unsigned long){ ++calls; });
+
+    CHECK( calls == 0 );
+  }
+
+  SECTION( "exception" )
+  {
+    CHECK_THROWS_AS(
+      pool.parallel_for(8, [](unsigned long i){ if (i == 3) throw std::runtime_error("task failed"); }),
+      std::runtime_error
+    );
+  }
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "tests/test_classes.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE( "timestep_accumulator", "[timestep][accumulator]" )
+{
+  vecs::Timestep timestep(0.25);
+  unsigned long ticks = 0;
+
+  CHECK( timestep.advance(1.0, [&](){ ++ticks; }) == 4 );
+  CHECK( timestep.advance(0.125, [&](){ ++ticks; }) == 0 );
+  CHECK( timestep.alpha() == 0.5 );
+  CHECK( timestep.advance(0.125, [&](){ ++ticks; }) == 1 );
+  CHECK( timestep.advance(-1.0, [&](){ ++ticks; }) == 0 );
+
+  CHECK( ticks == 5 );
+  CHECK( timestep.ticks() == 5 );
+  CHECK( timestep.time() == 1.25 );
+  CHECK( timestep.stats().skipped == 0 );
+  CHECK( timestep.stats().lag == 0.0 );
+  CHECK( timestep.stats().peak >= timestep.stats().average );
+
+  CHECK_THROWS_AS( vecs::Timestep(0.0), std::runtime_error );
+}
+
+TEST_CASE( "timestep_catch_up", "[timestep][catchup]" )
+{
+  vecs::Timestep timestep(0.25, 3);
+  unsigned long ticks = 0;
+
+  CHECK( timestep.advance(2.125, [&](){ ++ticks; }) == 3 );
+  CHECK( ticks == 3 );
+  CHECK( timestep.stats().skipped == 5 );
+  CHECK( timestep.stats().lag == 0.125 );
+
+  CHECK( timestep.advance(0.125, [&](){ ++ticks; }) == 1 );
+  CHECK( timestep.time() == 1.0 );
+  CHECK( vecs::Timestep(0.25, 0).max_catch_up() == 1 );
+}
+
+TEST_CASE( "timestep_present", "[timestep][present]" )
+{
+  vecs::Timestep uncapped(0.25);
+
+  CHECK( uncapped.present(0.0) );
+  CHECK( uncapped.present(0.01) );
+  CHECK( uncapped.stats().frames == 2 );
+
+  vecs::Timestep capped(0.25, 5, 4.0);
+  std::vector<bool> frames;
+  for (double seconds : { 0.125, 0.125, 0.0625, 0.1875, 1.0 })
+    frames.push_back(capped.present(seconds));
+
+  CHECK( frames == std::vector<bool>{ false, true, false, true, true } );
+  CHECK( capped.stats().frames == 3 );
+}
+
+TEST_CASE( "timestep_systems", "[timestep][systems]" )
+{
+  struct TestType
+  {
+    int a = 0;
+  };
+
+  class TestSystem : public vecs::System
+  {
+    public:
+      void update(const std::shared_ptr<vecs::ComponentManager>& c_manager, const vecs::View& e_ids) override
+      {
+        for (const auto& e_id : e_ids)
+          ++c_manager->get<TestType>(e_id).a;
+      }
+  };
+
+  auto c_manager = std::make_shared<vecs::ComponentManager>();
+  vecs::EntityManager e_manager;
+  vecs::SystemManager s_manager;
+
+  c_manager->register_components<TestType>();
+  s_manager.emplace<TestSystem>();
+  s_manager.add_components<TestSystem, TestType>();
+
+  auto e_id = e_manager.new_entity();
+  e_manager.add_components<TestType>(e_id);
+  c_manager->update_data(e_id, TestType{});
+
+  vecs::Timestep timestep(0.5, 2);
+  for (double seconds : { 0.25, 0.25, 3.0, 0.5 })
+    timestep.advance(seconds, [&](){ s_manager.update(c_manager, e_manager); });
+
+  CHECK( c_manager->get<TestType>(e_id).a == 4 );
+  CHECK( timestep.stats().skipped == 4 );
+}
\ No newline at end of file